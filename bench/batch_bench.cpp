@@ -0,0 +1,162 @@
+// Пачки смешанных insert(index) / erase(index) / insert_middle: вызовы по одной против
+// журнала MutationBatch, примененного одним проходом (apply). Сначала случайная проверка
+// свойства «apply дает тот же результат, что вызовы по одной» на коротких контейнерах
+// (int и std::string, все три контейнера), затем замер времени на длинных.
+// Использование: batch_bench [n] [repeats]  (по умолчанию n = 50000, repeats = 3)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+#include "DynamicArray.h"
+#include "MutationBatch.h"
+#include "SinglyLinkedList.h"
+
+template <typename F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Одна операция пачки; индексы — относительно длины после предыдущих операций
+struct Op {
+    enum Kind { Insert, Erase, InsertMiddle } kind;
+    size_t index;
+    int value;
+};
+
+std::vector<Op> make_ops(size_t n, size_t k, std::mt19937& rng) {
+    std::vector<Op> ops;
+    size_t length = n;
+    for (size_t i = 0; i < k; ++i) {
+        Op op{static_cast<Op::Kind>(rng() % 3), 0, static_cast<int>(rng() % 1000)};
+        if (length == 0 && op.kind == Op::Erase) op.kind = Op::Insert;
+        if (op.kind == Op::Insert) op.index = rng() % (length + 1);
+        if (op.kind == Op::Erase) op.index = rng() % length;
+        length += op.kind == Op::Erase ? -1 : 1;
+        ops.push_back(op);
+    }
+    return ops;
+}
+
+template <typename T>
+T make_value(int value) {
+    if constexpr (std::is_same<T, std::string>::value) return "value " + std::to_string(value); // строка в куче
+    else return static_cast<T>(value);
+}
+
+template <typename Container, typename T>
+void apply_one_by_one(Container& container, const std::vector<Op>& ops) {
+    for (const Op& op : ops) {
+        if (op.kind == Op::Insert) container.insert(op.index, make_value<T>(op.value));
+        else if (op.kind == Op::Erase) container.erase(op.index);
+        else container.insert_middle(make_value<T>(op.value));
+    }
+}
+
+template <typename Container, typename T>
+void apply_batch(Container& container, size_t n, const std::vector<Op>& ops) {
+    MutationBatch<T> batch(n);
+    for (const Op& op : ops) {
+        if (op.kind == Op::Insert) batch.insert(op.index, make_value<T>(op.value));
+        else if (op.kind == Op::Erase) batch.erase(op.index);
+        else batch.insert_middle(make_value<T>(op.value));
+    }
+    container.apply(std::move(batch));
+}
+
+template <typename Container, typename T>
+void fill(Container& container, size_t n) {
+    for (size_t i = 0; i < n; ++i) container.push_back(make_value<T>(static_cast<int>(i)));
+}
+
+template <typename Container>
+auto contents(const Container& container) {
+    std::vector<typename Container::value_type> items;
+    for (const auto& item : container) items.push_back(item);
+    return items;
+}
+
+// Случайные пачки на коротких контейнерах: результат apply совпадает с вызовами по одной
+template <typename Container, typename T>
+void check_property(const char* name, size_t trials) {
+    std::mt19937 rng(5);
+    for (size_t trial = 0; trial < trials; ++trial) {
+        size_t n = rng() % 40, k = rng() % 60;
+        std::vector<Op> ops = make_ops(n, k, rng);
+        Container expected, actual;
+        fill<Container, T>(expected, n);
+        fill<Container, T>(actual, n);
+        apply_one_by_one<Container, T>(expected, ops);
+        apply_batch<Container, T>(actual, n, ops);
+        if (contents(expected) != contents(actual)) {
+            std::cerr << name << ": batch result differs from one-by-one (trial " << trial << ", n = " << n
+                      << ", k = " << k << ")\n";
+            std::exit(1);
+        }
+    }
+}
+
+struct Timing {
+    double one_by_one_ms = 0, batch_ms = 0;
+};
+
+template <typename Container>
+Timing run(size_t n, size_t k, size_t repeats) {
+    Timing timing;
+    std::mt19937 rng(9);
+    for (size_t r = 0; r < repeats; ++r) {
+        std::vector<Op> ops = make_ops(n, k, rng);
+        Container calls, batched;
+        fill<Container, int>(calls, n);
+        fill<Container, int>(batched, n);
+        timing.one_by_one_ms += measure_ms([&] { apply_one_by_one<Container, int>(calls, ops); });
+        timing.batch_ms += measure_ms([&] { apply_batch<Container, int>(batched, n, ops); });
+        if (contents(calls) != contents(batched)) {
+            std::cerr << "batch result differs from one-by-one\n";
+            std::exit(1);
+        }
+    }
+    timing.one_by_one_ms /= repeats;
+    timing.batch_ms /= repeats;
+    return timing;
+}
+
+template <typename Container>
+void print_rows(const char* name, size_t n, size_t repeats) {
+    for (size_t k : {16, 256, 4096}) {
+        Timing timing = run<Container>(n, k, repeats);
+        std::cout << std::left << std::setw(20) << name << std::right << std::setw(8) << k << std::fixed
+                  << std::setprecision(3) << std::setw(14) << timing.one_by_one_ms << std::setw(12)
+                  << timing.batch_ms << std::setw(10) << std::setprecision(1)
+                  << timing.one_by_one_ms / timing.batch_ms << "x\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000;
+    size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+
+    const size_t trials = 500;
+    check_property<DynamicArray<int>, int>("DynamicArray<int>", trials);
+    check_property<DynamicArray<std::string>, std::string>("DynamicArray<string>", trials);
+    check_property<SinglyLinkedList<int>, int>("SinglyLinkedList<int>", trials);
+    check_property<SinglyLinkedList<std::string>, std::string>("SinglyLinkedList<string>", trials);
+    check_property<DoublyLinkedList<int>, int>("DoublyLinkedList<int>", trials);
+    check_property<DoublyLinkedList<std::string>, std::string>("DoublyLinkedList<string>", trials);
+    std::cout << "property check: " << trials << " random batches per container match one-by-one calls\n\n";
+
+    std::cout << "n = " << n << ", ms per batch (mean of " << repeats << ")\n";
+    std::cout << std::left << std::setw(20) << "container" << std::right << std::setw(8) << "ops"
+              << std::setw(14) << "one-by-one" << std::setw(12) << "batch" << std::setw(11) << "speedup" << '\n';
+    print_rows<DynamicArray<int>>("DynamicArray", n, repeats);
+    print_rows<SinglyLinkedList<int>>("SinglyLinkedList", n, repeats);
+    print_rows<DoublyLinkedList<int>>("DoublyLinkedList", n, repeats);
+    return 0;
+}
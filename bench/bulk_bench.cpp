@@ -0,0 +1,104 @@
+// Сравнение пакетных операций bulk:: (BulkOps.h) с простым циклом по DynamicArray
+// на уровнях Scalar / SSE / AVX2 для int и float.
+// Использование: bulk_bench [max_exp]  (n = 10^3 .. 10^max_exp, по умолчанию 7)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "BulkOps.h"
+#include "DynamicArray.h"
+
+static volatile double sink; // не дает компилятору выбросить результаты
+
+// Среднее время одного прохода в наносекундах на элемент
+template <typename F>
+double ns_per_element(size_t n, F f) {
+    size_t repeats = std::max<size_t>(1, 20000000 / n);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repeats; ++r) f();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / repeats / n;
+}
+
+const char* level_name(bulk::SimdLevel level) {
+    switch (level) {
+    case bulk::SimdLevel::AVX2: return "avx2";
+    case bulk::SimdLevel::SSE: return "sse";
+    default: return "scalar";
+    }
+}
+
+template <typename T>
+void run(const char* type, size_t n) {
+    DynamicArray<T> a(0), b(0), out(0);
+    a.reserve(n);
+    b.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        a.push_back(static_cast<T>(i % 1000));
+        b.push_back(static_cast<T>((i * 7) % 1000));
+    }
+    out.resize(n);
+    T missing = static_cast<T>(-1); // find проходит массив целиком
+
+    // Простые циклы, которые раньше писались вручную вокруг DynamicArray
+    double loop[7];
+    loop[0] = ns_per_element(n, [&] { double s = 0; for (size_t i = 0; i < n; ++i) s += a[i]; sink = s; });
+    loop[1] = ns_per_element(n, [&] {
+        T lo = a[0], hi = a[0];
+        for (size_t i = 1; i < n; ++i) { lo = std::min(lo, a[i]); hi = std::max(hi, a[i]); }
+        sink = lo + hi;
+    });
+    loop[2] = ns_per_element(n, [&] { size_t i = 0; while (i < n && a[i] != missing) ++i; sink = i; });
+    loop[3] = ns_per_element(n, [&] { size_t c = 0; for (size_t i = 0; i < n; ++i) c += a[i] == a[0]; sink = c; });
+    loop[4] = ns_per_element(n, [&] { for (size_t i = 0; i < n; ++i) out[i] = a[i] * 2 + 1; sink = out[n / 2]; });
+    loop[5] = ns_per_element(n, [&] { double s = 0; for (size_t i = 0; i < n; ++i) s += a[i] * b[i]; sink = s; });
+    loop[6] = ns_per_element(n, [&] { for (size_t i = 0; i < n; ++i) out[i] = 3; sink = out[n / 2]; });
+
+    const char* names[7] = {"sum", "min_max", "find", "count", "transform", "dot", "fill"};
+    for (int k = 0; k < 7; ++k) {
+        std::cout << std::left << std::setw(7) << type << std::setw(11) << names[k]
+                  << std::right << std::setw(10) << n
+                  << std::fixed << std::setprecision(3) << std::setw(10) << loop[k];
+        for (int level = 0; level <= static_cast<int>(bulk::supported_level()); ++level) {
+            bulk::set_simd_level(static_cast<bulk::SimdLevel>(level));
+            double t = 0;
+            switch (k) {
+            case 0: t = ns_per_element(n, [&] { sink = static_cast<double>(bulk::sum(a.view())); }); break;
+            case 1: t = ns_per_element(n, [&] { sink = bulk::min_max(a.view()).second; }); break;
+            case 2: t = ns_per_element(n, [&] { sink = bulk::find(a.view(), missing); }); break;
+            case 3: t = ns_per_element(n, [&] { sink = bulk::count(a.view(), a[0]); }); break;
+            case 4:
+                t = ns_per_element(n, [&] { bulk::transform(a.view(), out.view(), [](T x) { return x * 2 + 1; }); sink = out[n / 2]; });
+                break;
+            case 5: t = ns_per_element(n, [&] { sink = static_cast<double>(bulk::dot(a.view(), b.view())); }); break;
+            case 6: t = ns_per_element(n, [&] { bulk::fill(out.view(), static_cast<T>(3)); sink = out[n / 2]; }); break;
+            }
+            std::cout << std::setw(10) << t;
+        }
+        std::cout << '\n';
+    }
+    bulk::set_simd_level(bulk::supported_level());
+}
+
+int main(int argc, char** argv) {
+    int max_exp = argc > 1 ? std::atoi(argv[1]) : 7;
+
+    std::cout << "ns per element; supported level: " << level_name(bulk::supported_level()) << '\n';
+    std::cout << std::left << std::setw(7) << "type" << std::setw(11) << "kernel"
+              << std::right << std::setw(10) << "n" << std::setw(10) << "loop";
+    for (int level = 0; level <= static_cast<int>(bulk::supported_level()); ++level) {
+        std::cout << std::setw(10) << level_name(static_cast<bulk::SimdLevel>(level));
+    }
+    std::cout << '\n';
+
+    size_t n = 1000;
+    for (int e = 3; e <= max_exp; ++e, n *= 10) {
+        run<int>("int", n);
+        run<float>("float", n);
+    }
+    return 0;
+}
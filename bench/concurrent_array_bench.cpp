@@ -0,0 +1,91 @@
+// Параллельное заполнение массива из нескольких потоков: DynamicArray под мьютексом,
+// ConcurrentArray (fetch_add + сегменты) и ThreadBufferedArray (буферы потоков + слияние).
+// Использование: concurrent_array_bench [n] [max_threads]  (по умолчанию n = 4000000, max_threads = 8)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentArray.h"
+#include "DynamicArray.h"
+
+// Запускает threads потоков, каждый вызывает body(t) для своей доли из n элементов
+template <typename Body>
+double measure_threads(size_t threads, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) workers.emplace_back(body, t);
+    for (std::thread& worker : workers) worker.join();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Каждое значение 0..n-1 должно встретиться ровно один раз
+template <typename Array>
+void check(const Array& array, size_t n, const char* name) {
+    long long sum = 0;
+    for (size_t i = 0; i < array.size(); ++i) sum += array[i];
+    if (array.size() != n || sum != static_cast<long long>(n) * static_cast<long long>(n - 1) / 2) {
+        std::cerr << name << ": lost or duplicated elements\n";
+        std::exit(1);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8;
+
+    std::cout << "n = " << n << ", hardware threads = " << std::thread::hardware_concurrency() << " (ms)\n";
+    std::cout << std::left << std::setw(9) << "threads"
+              << std::right << std::setw(14) << "mutex array"
+              << std::setw(14) << "concurrent"
+              << std::setw(14) << "to array"
+              << std::setw(14) << "buffered"
+              << std::setw(14) << "merge" << '\n';
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        DynamicArray<int> locked(0);
+        std::mutex mutex;
+        double mutex_ms = measure_threads(threads, [&](size_t t) {
+            for (size_t i = t; i < n; i += threads) {
+                std::lock_guard<std::mutex> lock(mutex);
+                locked.push_back(static_cast<int>(i));
+            }
+        });
+        check(locked, n, "mutex array");
+
+        ConcurrentArray<int> concurrent;
+        double concurrent_ms = measure_threads(threads, [&](size_t t) {
+            for (size_t i = t; i < n; i += threads) concurrent.push_back(static_cast<int>(i));
+        });
+        check(concurrent, n, "ConcurrentArray");
+        DynamicArray<int> moved(0);
+        auto start = std::chrono::steady_clock::now();
+        concurrent.move_to(moved);
+        double move_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        check(moved, n, "ConcurrentArray::move_to");
+
+        ThreadBufferedArray<int> buffered;
+        double buffered_ms = measure_threads(threads, [&](size_t t) {
+            DynamicArray<int>& local = buffered.local();
+            for (size_t i = t; i < n; i += threads) local.push_back(static_cast<int>(i));
+        });
+        DynamicArray<int> merged(0);
+        start = std::chrono::steady_clock::now();
+        merged = buffered.merge();
+        double merge_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        check(merged, n, "ThreadBufferedArray::merge");
+
+        std::cout << std::left << std::setw(9) << threads
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(14) << mutex_ms
+                  << std::setw(14) << concurrent_ms
+                  << std::setw(14) << move_ms
+                  << std::setw(14) << buffered_ms
+                  << std::setw(14) << merge_ms << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Пропускная способность lock-free очереди и стека (ConcurrentList.h) против
+// SinglyLinkedList под общим мьютексом: p производителей и p потребителей, p = 1..max_threads.
+// Использование: concurrent_bench [n] [max_threads]  (по умолчанию n = 1000000, max_threads = 8)
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentList.h"
+#include "SinglyLinkedList.h"
+
+// SinglyLinkedList, каждый вызов которого защищен одним мьютексом
+template <bool Fifo>
+class MutexList {
+private:
+    std::mutex mutex;
+    SinglyLinkedList<long long> list;
+
+public:
+    void push(long long value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (Fifo) list.push_back(value);
+        else list.push_front(value);
+    }
+
+    bool try_pop(long long& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.size() == 0) return false;
+        out = list.front();
+        list.pop_front();
+        return true;
+    }
+};
+
+// Миллионы операций (push + pop) в секунду; каждое значение должно быть извлечено ровно один раз
+template <typename Container>
+double run(size_t n, size_t threads) {
+    Container container;
+    std::atomic<size_t> popped(0);
+    std::atomic<long long> popped_sum(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> workers;
+
+    for (size_t p = 0; p < threads; ++p) {
+        workers.emplace_back([&, p] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (size_t i = p; i < n; i += threads) container.push(static_cast<long long>(i));
+        });
+    }
+    for (size_t c = 0; c < threads; ++c) {
+        workers.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            long long sum = 0, value;
+            while (popped.load(std::memory_order_relaxed) < n) {
+                if (container.try_pop(value)) {
+                    sum += value;
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            popped_sum.fetch_add(sum);
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long expected = static_cast<long long>(n) * static_cast<long long>(n - 1) / 2;
+    if (popped_sum.load() != expected) {
+        std::cerr << "lost or duplicated elements: sum " << popped_sum.load() << " != " << expected << '\n';
+        std::exit(1);
+    }
+    return 2.0 * n / seconds / 1e6;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8;
+
+    std::cout << "n = " << n << ", hardware threads = " << std::thread::hardware_concurrency()
+              << " (Mops/s, producers = consumers = p)\n";
+    std::cout << std::left << std::setw(6) << "p"
+              << std::right << std::setw(14) << "mutex queue"
+              << std::setw(14) << "lock-free q"
+              << std::setw(14) << "mutex stack"
+              << std::setw(14) << "lock-free st" << '\n';
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        std::cout << std::left << std::setw(6) << threads
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(14) << run<MutexList<true>>(n, threads)
+                  << std::setw(14) << run<LockFreeQueue<long long>>(n, threads)
+                  << std::setw(14) << run<MutexList<false>>(n, threads)
+                  << std::setw(14) << run<LockFreeStack<long long>>(n, threads) << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,220 @@
+// Набор повторяемых замеров для всех контейнеров: добавление в конец и в начало,
+// вставка и удаление по случайному индексу, insert_middle, обход, копирование и перемещение
+// на размерах 10^min_exp .. 10^max_exp. Печатает ns/op, пропускную способность
+// и число выделений памяти; результаты можно сохранить в JSON/CSV и сравнить между запусками.
+// Использование: container_bench [--min-exp 2] [--max-exp 7] [--filter text] [--json file] [--csv file]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+#include "DynamicArray.h"
+#include "GrowthPolicy.h"
+#include "Instrumentation.h"
+#include "SinglyLinkedList.h"
+#include "UnrolledList.h"
+
+static volatile long long sink; // не дает компилятору выбросить результаты
+
+// Выделения памяти считает политика инструментирования (Instrumentation.h). Счетчики атомарные
+// и заметно замедляют операции, поэтому время меряется на обычных контейнерах, а выделения —
+// отдельным проходом на таких же контейнерах с CountingInstrumentation
+struct BenchTag {};
+using Stats = StatsInstrumentation<BenchTag>;
+
+// Операции, которые в контейнерах называются по-разному
+template <typename G, typename I>
+void prepend(DynamicArray<int, G, I>& array, int value) { array.insert(0, value); }
+template <typename Container>
+void prepend(Container& container, int value) { container.push_front(value); }
+
+// Контейнер-приемник копии или перемещения: свой для каждого типа, разрушается вне замера
+template <typename Container>
+std::optional<Container>& spare() {
+    static std::optional<Container> instance;
+    return instance;
+}
+
+struct Result {
+    std::string container;
+    std::string workload;
+    size_t n;
+    size_t ops;         // операций за повтор
+    size_t repeats;
+    double ns_per_op;
+    double mops;        // миллионов операций в секунду
+    double allocs_per_op;
+};
+
+struct Options {
+    int min_exp = 2;
+    int max_exp = 7;
+    std::string filter;
+    std::string json_path;
+    std::string csv_path;
+};
+
+// Для операций за O(n) число операций уменьшается с ростом n, чтобы замер укладывался в секунды
+size_t linear_ops(size_t n) {
+    return std::min<size_t>(1000, std::max<size_t>(10, 10000000 / n));
+}
+
+// Plain — контейнер для замера времени, Counted — он же с политикой Stats для подсчета выделений
+template <typename Plain, typename Counted>
+class Runner {
+private:
+    const char* name;
+    size_t n;
+    const Options& options;
+    std::vector<Result>& results;
+    std::vector<unsigned> random; // заранее сгенерированные случайные числа для позиций
+
+    template <typename Container>
+    static void fill(Container& container, size_t n) {
+        for (size_t i = 0; i < n; ++i) container.push_back(static_cast<int>(i));
+    }
+
+    // setup(container) не входит в замер, body(container) выполняет ops операций;
+    // work — примерное число элементарных шагов за повтор, по нему выбирается число повторов
+    template <typename Setup, typename Body>
+    void run(const char* workload, size_t ops, size_t work, Setup setup, Body body) {
+        if (!options.filter.empty() && (std::string(name) + "/" + workload).find(options.filter) == std::string::npos) return;
+
+        size_t repeats = std::min<size_t>(1000, std::max<size_t>(1, 2000000 / (work + 1)));
+        double ns = 0;
+        for (size_t r = 0; r < repeats; ++r) {
+            std::optional<Plain> container;
+            container.emplace();
+            setup(*container);
+            auto start = std::chrono::steady_clock::now();
+            body(*container);
+            ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        size_t allocations;
+        {
+            Counted container;
+            setup(container);
+            size_t before = Stats::snapshot().allocations;
+            body(container);
+            allocations = Stats::snapshot().allocations - before;
+        }
+
+        double total_ops = static_cast<double>(ops) * repeats;
+        Result result = {name, workload, n, ops, repeats, ns / total_ops, total_ops / ns * 1e3,
+                         static_cast<double>(allocations) / ops};
+        std::cout << std::left << std::setw(18) << result.container << std::setw(14) << result.workload
+                  << std::right << std::setw(10) << result.n << std::setw(10) << result.ops
+                  << std::fixed << std::setprecision(2) << std::setw(12) << result.ns_per_op
+                  << std::setprecision(3) << std::setw(12) << result.mops << std::setprecision(4) << std::setw(12) << result.allocs_per_op << '\n';
+        results.push_back(result);
+    }
+
+public:
+    Runner(const char* container_name, size_t size, const Options& opts, std::vector<Result>& out)
+        : name(container_name), n(size), options(opts), results(out) {
+        std::mt19937 rng(static_cast<unsigned>(size));
+        random.resize(1000);
+        for (unsigned& value : random) value = static_cast<unsigned>(rng());
+    }
+
+    void run_all() {
+        size_t k = linear_ops(n);
+        size_t linear_work = n + k * n / 4; // k операций, каждая может пройти часть контейнера
+        auto filled = [this](auto& c) { fill(c, n); };
+
+        run("append", n, n, [](auto&) {}, [this](auto& c) { fill(c, n); });
+        run("prepend", k, linear_work, filled, [k](auto& c) {
+            for (size_t i = 0; i < k; ++i) prepend(c, static_cast<int>(i));
+        });
+        run("random_insert", k, linear_work, filled, [this, k](auto& c) {
+            for (size_t i = 0; i < k; ++i) c.insert(random[i] % (n + i + 1), static_cast<int>(i));
+        });
+        run("random_erase", std::min(k, n), linear_work, filled, [this, k](auto& c) {
+            for (size_t i = 0; i < std::min(k, n); ++i) c.erase(random[i] % (n - i));
+        });
+        run("insert_middle", k, linear_work, filled, [k](auto& c) {
+            for (size_t i = 0; i < k; ++i) c.insert_middle(static_cast<int>(i));
+        });
+        run("scan", n, n, filled, [](auto& c) {
+            long long sum = 0;
+            for (int value : c) sum += value;
+            sink = sum;
+        });
+
+        // Результат прошлого повтора разрушается в setup, вне замера
+        auto spare_filled = [this](auto& c) {
+            spare<std::decay_t<decltype(c)>>().reset();
+            fill(c, n);
+        };
+        run("copy", n, n, spare_filled, [](auto& c) { spare<std::decay_t<decltype(c)>>().emplace(c); });
+        run("move", 1, n, spare_filled, [](auto& c) { spare<std::decay_t<decltype(c)>>().emplace(std::move(c)); });
+        spare<Plain>().reset();
+        spare<Counted>().reset();
+    }
+};
+
+void write_json(const std::string& path, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "  {\"container\": \"" << r.container << "\", \"workload\": \"" << r.workload
+            << "\", \"n\": " << r.n << ", \"ops\": " << r.ops << ", \"repeats\": " << r.repeats
+            << ", \"ns_per_op\": " << r.ns_per_op << ", \"mops\": " << r.mops
+            << ", \"allocs_per_op\": " << r.allocs_per_op << "}" << (i + 1 < results.size() ? "," : "") << '\n';
+    }
+    out << "]\n";
+}
+
+void write_csv(const std::string& path, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    out << "container,workload,n,ops,repeats,ns_per_op,mops,allocs_per_op\n";
+    for (const Result& r : results) {
+        out << r.container << ',' << r.workload << ',' << r.n << ',' << r.ops << ',' << r.repeats << ','
+            << r.ns_per_op << ',' << r.mops << ',' << r.allocs_per_op << '\n';
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--min-exp") == 0) options.min_exp = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--max-exp") == 0) options.max_exp = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--filter") == 0) options.filter = argv[i + 1];
+        else if (std::strcmp(argv[i], "--json") == 0) options.json_path = argv[i + 1];
+        else if (std::strcmp(argv[i], "--csv") == 0) options.csv_path = argv[i + 1];
+        else {
+            std::cerr << "unknown option " << argv[i] << '\n';
+            return 1;
+        }
+    }
+
+    std::cout << std::left << std::setw(18) << "container" << std::setw(14) << "workload"
+              << std::right << std::setw(10) << "n" << std::setw(10) << "ops"
+              << std::setw(12) << "ns/op" << std::setw(12) << "Mops/s" << std::setw(12) << "allocs/op" << '\n';
+
+    std::vector<Result> results;
+    size_t n = 1;
+    for (int e = 0; e < options.min_exp; ++e) n *= 10;
+    for (int e = options.min_exp; e <= options.max_exp; ++e, n *= 10) {
+        Runner<DynamicArray<int>, DynamicArray<int, GrowthFactor1_5, Stats>>("DynamicArray", n, options, results).run_all();
+        Runner<SinglyLinkedList<int>, SinglyLinkedList<int, std::allocator<int>, Stats>>("SinglyLinkedList", n, options, results).run_all();
+        Runner<DoublyLinkedList<int>, DoublyLinkedList<int, std::allocator<int>, Stats>>("DoublyLinkedList", n, options, results).run_all();
+        Runner<UnrolledList<int>, UnrolledList<int, 64, std::allocator<int>, Stats>>("UnrolledList", n, options, results).run_all();
+    }
+
+    if (!options.json_path.empty()) write_json(options.json_path, results);
+    if (!options.csv_path.empty()) write_csv(options.csv_path, results);
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Сравнение политик роста DynamicArray: число перевыделений и объем
+// перенесенных байт при N последовательных push_back.
+// Использование: growth_bench [max_exp]  (N = 10^3 .. 10^max_exp, по умолчанию 8)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "DynamicArray.h"
+
+// Обертка над политикой, считающая вызовы (каждый вызов — одно перевыделение)
+template <typename Policy>
+struct CountingGrowth {
+    static size_t reallocations;
+    static size_t bytes_copied;
+
+    static size_t next_capacity(size_t current, size_t required, size_t element_size) {
+        ++reallocations;
+        bytes_copied += (required - 1) * element_size; // при росте переносятся все существующие элементы
+        return Policy::next_capacity(current, required, element_size);
+    }
+
+    static void reset() {
+        reallocations = 0;
+        bytes_copied = 0;
+    }
+};
+
+template <typename Policy> size_t CountingGrowth<Policy>::reallocations = 0;
+template <typename Policy> size_t CountingGrowth<Policy>::bytes_copied = 0;
+
+// Пользовательская политика: фиксированный шаг в 1024 элемента
+struct FixedStepGrowth {
+    static size_t next_capacity(size_t current, size_t required, size_t) {
+        size_t next = current + 1024;
+        return next < required ? required : next;
+    }
+};
+
+template <typename Policy>
+void run(const char* name, size_t n) {
+    using Counting = CountingGrowth<Policy>;
+    Counting::reset();
+
+    auto start = std::chrono::steady_clock::now();
+    size_t capacity = 0;
+    {
+        DynamicArray<int, Counting> arr(0); // нулевая начальная емкость — проверяем минимальный порог
+        for (size_t i = 0; i < n; ++i) {
+            arr.push_back(static_cast<int>(i));
+        }
+        capacity = arr.getCapacity();
+    }
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::left << std::setw(14) << name
+              << std::right << std::setw(12) << n
+              << std::setw(10) << Counting::reallocations
+              << std::setw(16) << Counting::bytes_copied
+              << std::setw(14) << capacity
+              << std::setw(12) << std::fixed << std::setprecision(2) << elapsed << '\n';
+}
+
+int main(int argc, char** argv) {
+    int max_exp = argc > 1 ? std::atoi(argv[1]) : 8;
+
+    std::cout << std::left << std::setw(14) << "policy"
+              << std::right << std::setw(12) << "appends"
+              << std::setw(10) << "reallocs"
+              << std::setw(16) << "bytes_copied"
+              << std::setw(14) << "capacity"
+              << std::setw(12) << "ms" << '\n';
+
+    size_t n = 1000;
+    for (int e = 3; e <= max_exp; ++e, n *= 10) {
+        run<GrowthFactor1_5>("x1.5", n);
+        run<GrowthFactor2>("x2", n);
+        run<PageGranularGrowth<>>("page", n);
+        // Шаг в 1024 элемента квадратичен по числу копирований — на больших N не запускаем
+        if (n <= 1000000) run<FixedStepGrowth>("fixed+1024", n);
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+// DoublyLinkedList (узлы в куче или в пуле) против IndexLinkedList (узлы в одном массиве,
+// 32-битные индексы): байт на элемент и скорость обхода сразу после построения, после
+// перемешивания (erase + insert в случайных местах, узлы разбросаны по памяти) и после compact().
+// Использование: index_list_bench [n]  (по умолчанию n = 1000000)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "DoublyLinkedList.h"
+#include "IndexLinkedList.h"
+#include "NodePool.h"
+
+static volatile long long sink; // не дает компилятору выбросить обход
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Занятая в куче память вместе с заголовками блоков malloc и крупными блоками через mmap
+size_t heap_in_use() {
+#ifdef __GLIBC__
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+template <typename List>
+long long scan(const List& list, double& ms) {
+    const int repeats = 5;
+    long long sum = 0;
+    ms = measure([&] {
+        for (int r = 0; r < repeats; ++r) {
+            for (int value : list) sum += value;
+        }
+    }) / repeats;
+    return sum / repeats;
+}
+
+template <typename List>
+void compact_if_possible(List&) {}
+template <typename T, typename I>
+void compact_if_possible(IndexLinkedList<T, I>& list) { list.compact(); }
+
+// Возвращает сумму после перемешивания, чтобы сверить контейнеры между собой
+template <typename List>
+long long run(const char* name, size_t n, bool compactable) {
+    size_t before = heap_in_use();
+    long long result;
+    {
+        List list;
+        double build = measure([&] {
+            for (size_t i = 0; i < n; ++i) list.push_back(static_cast<int>(i));
+        });
+        double bytes = static_cast<double>(heap_in_use() - before) / n;
+
+        double fresh_ms, churned_ms, compact_ms = 0, compacted_ms = 0;
+        long long fresh = scan(list, fresh_ms);
+
+        // Два итератора на расстоянии n / 2 идут вперед случайными шагами: у первого элемент
+        // удаляется, перед вторым вставляется новый, и освободившийся узел уходит в другую часть списка
+        std::mt19937 rng(42);
+        auto removed = list.begin();
+        auto inserted = std::next(list.begin(), static_cast<std::ptrdiff_t>(n / 2));
+        auto advance = [&list](auto& position) {
+            if (++position == list.end()) position = list.begin();
+        };
+        double churn = measure([&] {
+            for (size_t i = 0; i < n; ++i) {
+                for (unsigned step = rng() % 16; step > 0; --step) {
+                    advance(removed);
+                    advance(inserted);
+                }
+                if (removed != inserted) {
+                    removed = list.erase(removed);
+                    if (removed == list.end()) removed = list.begin();
+                }
+                list.insert(inserted, static_cast<int>(i));
+            }
+        });
+        result = scan(list, churned_ms);
+        if (compactable) {
+            compact_ms = measure([&] { compact_if_possible(list); });
+            if (scan(list, compacted_ms) != result) {
+                std::cerr << "compact changed the list\n";
+                std::exit(1);
+            }
+        }
+
+        std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << bytes << std::setprecision(2) << std::setw(10) << build
+                  << std::setw(10) << fresh_ms << std::setw(10) << churn << std::setw(12) << churned_ms;
+        if (compactable) std::cout << std::setw(12) << compact_ms << std::setw(12) << compacted_ms;
+        std::cout << '\n';
+        sink = fresh;
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::cout << "n = " << n << ", int elements; scan ms — one full traversal\n";
+    std::cout << std::left << std::setw(22) << "list" << std::right << std::setw(10) << "B/elem"
+              << std::setw(10) << "build" << std::setw(10) << "scan" << std::setw(10) << "churn"
+              << std::setw(12) << "scan after" << std::setw(12) << "compact" << std::setw(12) << "scan after" << '\n';
+
+    long long expected = run<DoublyLinkedList<int>>("doubly / new", n, false);
+    long long pooled = run<DoublyLinkedList<int, PoolAllocator<int>>>("doubly / pool", n, false);
+    long long indexed = run<IndexLinkedList<int>>("index-linked", n, true);
+    if (pooled != expected || indexed != expected) {
+        std::cerr << "lists differ after churn\n";
+        return 1;
+    }
+    return 0;
+}
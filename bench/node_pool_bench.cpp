@@ -0,0 +1,106 @@
+// Сравнение выделения узлов списков через new на каждый узел (std::allocator)
+// и через пул PoolAllocator: число обращений к системному аллокатору,
+// время построения, обхода и «перемешивания» (erase + insert) списка.
+// Использование: node_pool_bench [n]  (по умолчанию n = 1000000)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+#include "NodePool.h"
+#include "SinglyLinkedList.h"
+
+static volatile long long sink; // не дает компилятору выбросить обход
+
+// std::allocator со счетчиком вызовов allocate
+static size_t heap_allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++heap_allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t system_allocations(const CountingAllocator<int>&) { return heap_allocations; }
+size_t system_allocations(const PoolAllocator<int>& alloc) { return alloc.stats().chunks; }
+
+
+template <typename List>
+void run(const char* name, size_t n) {
+    heap_allocations = 0;
+    List list;
+    std::vector<std::unique_ptr<long long>> noise; // посторонние объекты между узлами в куче
+    noise.reserve(n / 2 + 1);
+
+    double build = measure([&] {
+        for (size_t i = 0; i < n; ++i) {
+            list.push_back(static_cast<int>(i));
+            if (i % 2 == 0) noise.emplace_back(new long long(i));
+        }
+    });
+
+    long long sum = 0;
+    double scan = measure([&] {
+        for (int value : list) sum += value;
+    });
+
+    double churn = measure([&] {
+        for (size_t i = 0; i < n / 10; ++i) {
+            list.erase(0);
+            list.insert(0, static_cast<int>(i));
+        }
+    });
+
+    std::cout << std::left << std::setw(22) << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << build
+              << std::setw(12) << scan
+              << std::setw(12) << churn
+              << std::setw(14) << system_allocations(list.get_allocator()) << '\n';
+    sink = sum;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::cout << "n = " << n << '\n';
+    std::cout << std::left << std::setw(22) << "list"
+              << std::right << std::setw(12) << "build ms"
+              << std::setw(12) << "scan ms"
+              << std::setw(12) << "churn ms"
+              << std::setw(14) << "sys allocs" << '\n';
+
+    run<SinglyLinkedList<int, CountingAllocator<int>>>("singly / new", n);
+    run<SinglyLinkedList<int, PoolAllocator<int>>>("singly / pool", n);
+    run<DoublyLinkedList<int, CountingAllocator<int>>>("doubly / new", n);
+    run<DoublyLinkedList<int, PoolAllocator<int>>>("doubly / pool", n);
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Вывод больших контейнеров: print() через std::cout против write_to с буфером OutputFormat.h
+// в файловый дескриптор и в std::ofstream, в форматах plain/CSV/JSON, для int и double.
+// Вывод идет в файл; для print() stdout временно перенаправляется в тот же файл.
+// Использование: output_bench [n] [file]  (по умолчанию n = 1000000, file = /tmp/output_bench.txt)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "DoublyLinkedList.h"
+#include "DynamicArray.h"
+#include "OutputFormat.h"
+
+template <typename F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string read_file(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// print() с stdout, перенаправленным в path
+template <typename Container>
+double time_print(const Container& container, const std::string& path) {
+    std::fflush(stdout);
+    int saved = ::dup(STDOUT_FILENO);
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ::dup2(fd, STDOUT_FILENO);
+    ::close(fd);
+    double ms = measure_ms([&] {
+        container.print();
+        std::fflush(stdout);
+    });
+    ::dup2(saved, STDOUT_FILENO);
+    ::close(saved);
+    return ms;
+}
+
+// write_to в дескриптор файла path
+template <typename Container>
+double time_write_fd(const Container& container, const std::string& path, const OutputFormat& format) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    double ms = measure_ms([&] { container.write_to(fd, format); });
+    ::close(fd);
+    return ms;
+}
+
+template <typename Container>
+double time_write_stream(const Container& container, const std::string& path, const OutputFormat& format) {
+    std::ofstream out(path, std::ios::binary);
+    return measure_ms([&] {
+        container.write_to(out, format);
+        out.flush();
+    });
+}
+
+void print_row(const char* container, const char* method, size_t n, double ms, const std::string& path) {
+    std::ifstream size_probe(path, std::ios::binary | std::ios::ate);
+    double mb = static_cast<double>(size_probe.tellg()) / (1 << 20);
+    std::cout << std::left << std::setw(22) << container << std::setw(24) << method << std::right << std::setw(10) << n
+              << std::fixed << std::setprecision(2) << std::setw(12) << ms << std::setw(10) << mb
+              << std::setw(12) << mb / (ms / 1000) << '\n';
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::string path = argc > 2 ? argv[2] : "/tmp/output_bench.txt";
+
+    DynamicArray<int> ints(n);
+    DynamicArray<double> doubles(n);
+    DoublyLinkedList<int> list;
+    for (size_t i = 0; i < n; ++i) {
+        int value = static_cast<int>(i * 2654435761u % 2000000000u) - 1000000000;
+        ints.push_back(value);
+        doubles.push_back(value / 7.0);
+        list.push_back(value);
+    }
+
+    std::cout << std::left << std::setw(22) << "container" << std::setw(24) << "method" << std::right << std::setw(10) << "n"
+              << std::setw(12) << "ms" << std::setw(10) << "MB" << std::setw(12) << "MB/s" << '\n';
+
+    // DynamicArray::print() разделяет элементы ", " — тот же текст должен дать write_to
+    print_row("DynamicArray<int>", "print()", n, time_print(ints, path), path);
+    std::string printed = read_file(path);
+    print_row("DynamicArray<int>", "write_to(fd)", n, time_write_fd(ints, path, OutputFormat::plain(", ")), path);
+    if (read_file(path) != printed) {
+        std::cerr << "write_to output differs from print()\n";
+        return 1;
+    }
+    print_row("DynamicArray<int>", "write_to(ofstream)", n, time_write_stream(ints, path, OutputFormat::plain(", ")), path);
+    if (read_file(path) != printed) {
+        std::cerr << "write_to(ofstream) output differs from print()\n";
+        return 1;
+    }
+    print_row("DynamicArray<int>", "write_to(fd) csv", n, time_write_fd(ints, path, OutputFormat::csv()), path);
+    print_row("DynamicArray<int>", "write_to(fd) json", n, time_write_fd(ints, path, OutputFormat::json()), path);
+
+    print_row("DynamicArray<double>", "print()", n, time_print(doubles, path), path);
+    print_row("DynamicArray<double>", "write_to(fd)", n, time_write_fd(doubles, path, OutputFormat::plain(", ")), path);
+    // to_chars пишет кратчайшую точную запись: текст читается обратно без потерь
+    {
+        std::ifstream in(path);
+        size_t i = 0;
+        bool exact = true;
+        for (double value; i < n && in >> value; ++i) {
+            exact = exact && value == doubles[i];
+            in.ignore(1);
+        }
+        if (!exact || i != n) {
+            std::cerr << "double round trip failed\n";
+            return 1;
+        }
+    }
+
+    print_row("DoublyLinkedList<int>", "print()", n, time_print(list, path), path);
+    print_row("DoublyLinkedList<int>", "write_to(fd)", n, time_write_fd(list, path, OutputFormat::plain()), path);
+
+    std::remove(path.c_str());
+    return 0;
+}
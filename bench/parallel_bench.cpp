@@ -0,0 +1,99 @@
+// Ускорение параллельных алгоритмов (ParallelAlgorithms.h) в зависимости от числа потоков
+// по сравнению с последовательными std::sort, std::accumulate и обычными циклами.
+// Использование: parallel_bench [n] [max_threads]  (по умолчанию n = 4000000, max_threads = 8)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "DynamicArray.h"
+#include "ParallelAlgorithms.h"
+#include "ThreadPool.h"
+
+static volatile long long sink; // не дает компилятору выбросить результаты
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void require(bool condition, const char* what) {
+    if (!condition) {
+        std::cerr << what << ": result differs from the serial version\n";
+        std::exit(1);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8;
+
+    DynamicArray<int> input(0);
+    input.reserve(n);
+    std::mt19937 rng(1);
+    for (size_t i = 0; i < n; ++i) input.push_back(static_cast<int>(rng() % 1000000));
+
+    // Последовательные эталоны
+    DynamicArray<int> sorted = input;
+    double sort_ms = measure([&] { std::sort(sorted.begin(), sorted.end()); });
+    long long total = 0;
+    double reduce_ms = measure([&] { total = std::accumulate(input.begin(), input.end(), 0LL); });
+    DynamicArray<int> mapped = input;
+    double for_each_ms = measure([&] { for (int& x : mapped) x = x / 3 + 1; });
+    DynamicArray<long long> scanned(0);
+    for (int x : input) scanned.push_back(x);
+    double scan_ms = measure([&] { std::partial_sum(scanned.begin(), scanned.end(), scanned.begin()); });
+
+    std::cout << "n = " << n << ", hardware threads = " << std::thread::hardware_concurrency()
+              << " (ms, speedup vs serial in parentheses)\n";
+    std::cout << std::left << std::setw(9) << "threads"
+              << std::right << std::setw(18) << "sort"
+              << std::setw(18) << "reduce"
+              << std::setw(18) << "for_each"
+              << std::setw(18) << "scan" << '\n';
+    std::cout << std::left << std::setw(9) << "serial"
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(18) << sort_ms << std::setw(18) << reduce_ms
+              << std::setw(18) << for_each_ms << std::setw(18) << scan_ms << '\n';
+
+    auto cell = [](double ms, double serial_ms) {
+        std::cout << std::setw(10) << ms << " (" << std::setw(4) << serial_ms / ms << "x)";
+    };
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        ThreadPool pool(threads);
+
+        DynamicArray<int> a = input;
+        double t_sort = measure([&] { parallel_sort(a, std::less<int>(), default_parallel_grain, pool); });
+        require(std::equal(a.begin(), a.end(), sorted.begin()), "parallel_sort");
+
+        long long t_total = 0;
+        double t_reduce = measure([&] { t_total = parallel_reduce(input, 0LL, std::plus<long long>(), default_parallel_grain, pool); });
+        require(t_total == total, "parallel_reduce");
+
+        DynamicArray<int> b = input;
+        double t_for_each = measure([&] { parallel_for_each(b, [](int& x) { x = x / 3 + 1; }, default_parallel_grain, pool); });
+        require(std::equal(b.begin(), b.end(), mapped.begin()), "parallel_for_each");
+
+        DynamicArray<long long> c(0);
+        for (int x : input) c.push_back(x);
+        double t_scan = measure([&] { parallel_scan(c, std::plus<long long>(), default_parallel_grain, pool); });
+        require(std::equal(c.begin(), c.end(), scanned.begin()), "parallel_scan");
+
+        std::cout << std::left << std::setw(9) << threads << std::right;
+        cell(t_sort, sort_ms);
+        cell(t_reduce, reduce_ms);
+        cell(t_for_each, for_each_ms);
+        cell(t_scan, scan_ms);
+        std::cout << '\n';
+        sink = t_total;
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Сравнение пакетных insert/erase/erase_if DynamicArray с повторными
+// вызовами одноэлементных insert/erase.
+// Использование: range_bench [n] [k]  (по умолчанию n = 100000, k = 1000)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "DynamicArray.h"
+
+inline std::string make_value(size_t i, std::string*) { return std::string(24, static_cast<char>('a' + i % 26)); }
+inline int make_value(size_t i, int*) { return static_cast<int>(i); }
+
+template <typename T>
+DynamicArray<T> make_array(size_t n) {
+    DynamicArray<T> arr(0);
+    arr.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        arr.push_back(make_value(i, static_cast<T*>(nullptr)));
+    }
+    return arr;
+}
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* type, const char* op, double single_ms, double bulk_ms) {
+    std::cout << std::left << std::setw(8) << type << std::setw(24) << op
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << single_ms << std::setw(12) << bulk_ms
+              << std::setw(10) << single_ms / (bulk_ms > 0 ? bulk_ms : 1e-3) << "x\n";
+}
+
+template <typename T>
+void run(const char* type, size_t n, size_t k) {
+    size_t mid = n / 2;
+    T value = make_value(7, static_cast<T*>(nullptr));
+
+    // Удаление k подряд идущих элементов
+    DynamicArray<T> a = make_array<T>(n);
+    DynamicArray<T> b = make_array<T>(n);
+    double single = measure([&] { for (size_t i = 0; i < k; ++i) a.erase(mid); });
+    double bulk = measure([&] { b.erase(mid, mid + k); });
+    report(type, "erase range", single, bulk);
+
+    // Удаление каждого десятого элемента
+    a = make_array<T>(n);
+    b = make_array<T>(n);
+    single = measure([&] {
+        for (size_t i = a.size(); i-- > 0;) {
+            if (i % 10 == 0) a.erase(i);
+        }
+    });
+    size_t index = 0;
+    bulk = measure([&] { b.erase_if([&](const T&) { return index++ % 10 == 0; }); });
+    report(type, "erase every 10th", single, bulk);
+
+    // Вставка k копий значения
+    a = make_array<T>(n);
+    b = make_array<T>(n);
+    single = measure([&] { for (size_t i = 0; i < k; ++i) a.insert(mid, value); });
+    bulk = measure([&] { b.insert(mid, k, value); });
+    report(type, "insert count", single, bulk);
+
+    // Вставка диапазона из другого массива
+    DynamicArray<T> source = make_array<T>(k);
+    a = make_array<T>(n);
+    b = make_array<T>(n);
+    single = measure([&] { for (size_t i = 0; i < k; ++i) a.insert(mid + i, source.get(i)); });
+    bulk = measure([&] { b.insert(mid, source.data(), source.data() + source.size()); });
+    report(type, "insert range", single, bulk);
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t k = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+    std::cout << "n = " << n << ", k = " << k << '\n';
+    std::cout << std::left << std::setw(8) << "type" << std::setw(24) << "operation"
+              << std::right << std::setw(12) << "single ms" << std::setw(12) << "bulk ms"
+              << std::setw(11) << "speedup" << '\n';
+    run<int>("int", n, k);
+    run<std::string>("string", n, k);
+    return 0;
+}
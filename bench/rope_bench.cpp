@@ -0,0 +1,146 @@
+// Правки в случайных позициях: insert(index) + erase(index) в DynamicArray (сдвиг хвоста, O(n)),
+// DoublyLinkedList (поиск узла с ближайшего конца, O(n)) и IndexedRope (спуск по B-дереву, O(log n)).
+// Также get(index) в случайных позициях и полный обход. Число операций для O(n)-контейнеров
+// уменьшается с ростом n; время приводится на одну операцию. После правок содержимое
+// контейнеров сверяется.
+// Использование: rope_bench [max_n]  (по умолчанию 10000000; n = 10^5, 10^6, ... до max_n)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+#include "DynamicArray.h"
+#include "IndexedRope.h"
+
+static volatile long long sink;
+
+template <typename F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Правка сохраняет длину: вставка, затем удаление
+struct Edit {
+    size_t insert_at, erase_at;
+    int value;
+};
+
+template <typename Container>
+void apply_edits(Container& container, const std::vector<Edit>& edits, size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+        container.insert(edits[i].insert_at, edits[i].value);
+        container.erase(edits[i].erase_at);
+    }
+}
+
+template <typename Container>
+long long get_sum(const Container& container, const std::vector<size_t>& indices, size_t count) {
+    long long total = 0;
+    for (size_t i = 0; i < count; ++i) total += container.get(indices[i]);
+    return total;
+}
+
+template <typename Container>
+long long scan_sum(const Container& container) {
+    long long total = 0;
+    for (int value : container) total += value;
+    return total;
+}
+
+template <typename A, typename B>
+void check_same(const A& a, const B& b, const char* what) {
+    if (!std::equal(a.begin(), a.end(), b.begin())) {
+        std::cerr << "contents differ after edits: " << what << '\n';
+        std::exit(1);
+    }
+}
+
+void print_row(const char* name, size_t ops, double build_ms, double edit_us, double get_us, double scan_ns) {
+    std::cout << std::left << std::setw(18) << name << std::right << std::setw(8) << ops << std::fixed
+              << std::setprecision(1) << std::setw(12) << build_ms << std::setprecision(3) << std::setw(14) << edit_us
+              << std::setw(12) << get_us << std::setprecision(2) << std::setw(12) << scan_ns << '\n';
+}
+
+void run(size_t n) {
+    // Операций на O(n)-контейнерах: столько, чтобы каждый замер занимал порядка секунды в -O2
+    size_t array_ops = std::max<size_t>(20, std::min<size_t>(2000, 2000000000 / n));
+    size_t list_ops = std::max<size_t>(5, std::min<size_t>(2000, 200000000 / n));
+    size_t rope_ops = 20000, gets = 1000000;
+
+    std::mt19937 rng(3);
+    std::vector<Edit> edits(rope_ops);
+    for (Edit& edit : edits) {
+        edit.insert_at = rng() % (n + 1);
+        edit.erase_at = rng() % (n + 1);
+        edit.value = static_cast<int>(rng() % 1000);
+    }
+    std::vector<size_t> indices(gets);
+    for (size_t& index : indices) index = rng() % n;
+
+    DynamicArray<int> array;
+    DoublyLinkedList<int> list;
+    IndexedRope<int> rope;
+    double array_build = measure_ms([&] { for (size_t i = 0; i < n; ++i) array.push_back(static_cast<int>(i % 1000)); });
+    double list_build = measure_ms([&] { for (size_t i = 0; i < n; ++i) list.push_back(static_cast<int>(i % 1000)); });
+    double rope_build = measure_ms([&] { for (size_t i = 0; i < n; ++i) rope.push_back(static_cast<int>(i % 1000)); });
+
+    // Одни и те же правки: список делает первые list_ops, массив — первые array_ops, rope — все;
+    // get и обход замеряются, пока у массива и rope одинаковое содержимое
+    double list_edit = measure_ms([&] { apply_edits(list, edits, 0, list_ops); });
+    double rope_edit = measure_ms([&] { apply_edits(rope, edits, 0, list_ops); });
+    check_same(list, rope, "DoublyLinkedList vs IndexedRope");
+    rope_edit += measure_ms([&] { apply_edits(rope, edits, list_ops, array_ops); });
+    double array_edit = measure_ms([&] { apply_edits(array, edits, 0, array_ops); });
+    check_same(array, rope, "DynamicArray vs IndexedRope");
+
+    long long array_get = 0, rope_get = 0, list_get = 0;
+    double array_get_ms = measure_ms([&] { array_get = get_sum(array, indices, gets); });
+    double rope_get_ms = measure_ms([&] { rope_get = get_sum(rope, indices, gets); });
+    double list_get_ms = measure_ms([&] { list_get = get_sum(list, indices, list_ops); });
+    if (array_get != rope_get) {
+        std::cerr << "get() sums differ\n";
+        std::exit(1);
+    }
+
+    long long array_scan = 0, rope_scan = 0, list_scan = 0;
+    double array_scan_ms = measure_ms([&] { array_scan = scan_sum(array); });
+    double rope_scan_ms = measure_ms([&] { rope_scan = scan_sum(rope); });
+    double list_scan_ms = measure_ms([&] { list_scan = scan_sum(list); });
+    if (array_scan != rope_scan) {
+        std::cerr << "scan sums differ\n";
+        std::exit(1);
+    }
+    sink = array_get + list_get + list_scan;
+
+    // Остальные правки — только у rope (массиву на 10^7 они заняли бы десятки секунд)
+    rope_edit += measure_ms([&] { apply_edits(rope, edits, array_ops, rope_ops); });
+    if (rope.size() != n) {
+        std::cerr << "rope size changed\n";
+        std::exit(1);
+    }
+
+    std::cout << "n = " << n << " (rope depth " << rope.depth() << ")\n";
+    print_row("DynamicArray", array_ops, array_build, array_edit * 1000 / array_ops, array_get_ms * 1000 / gets,
+              array_scan_ms * 1e6 / n);
+    print_row("DoublyLinkedList", list_ops, list_build, list_edit * 1000 / list_ops, list_get_ms * 1000 / list_ops,
+              list_scan_ms * 1e6 / n);
+    print_row("IndexedRope", rope_ops, rope_build, rope_edit * 1000 / rope_ops, rope_get_ms * 1000 / gets,
+              rope_scan_ms * 1e6 / n);
+}
+
+int main(int argc, char** argv) {
+    size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    std::cout << std::left << std::setw(18) << "container" << std::right << std::setw(8) << "edits"
+              << std::setw(12) << "build ms" << std::setw(14) << "us/edit" << std::setw(12) << "us/get"
+              << std::setw(12) << "ns/elem" << '\n';
+    for (size_t n = 100000; n <= max_n; n *= 10) run(n);
+    return 0;
+}
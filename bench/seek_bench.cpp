@@ -0,0 +1,101 @@
+// Операции по случайному индексу в DoublyLinkedList: поиск только от головы
+// (прежнее поведение, воспроизводится проходом итератором от begin()),
+// поиск с ближайшего конца (insert/erase/get по индексу) и операции
+// через уже известный итератор.
+// Использование: seek_bench [max_exp] [ops]  (n = 10^4 .. 10^max_exp, по умолчанию 6 и 1000)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+
+using List = DoublyLinkedList<int>;
+
+static volatile long long sink; // не дает компилятору выбросить чтения
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+List make_list(size_t n) {
+    List list;
+    for (size_t i = 0; i < n; ++i) {
+        list.push_back(static_cast<int>(i));
+    }
+    return list;
+}
+
+DoublyLinkedListIterator<int> forward_seek(List& list, size_t index) {
+    DoublyLinkedListIterator<int> it = list.begin();
+    for (size_t i = 0; i < index; ++i) ++it;
+    return it;
+}
+
+void row(const char* op, size_t n, double forward, double nearest, double held) {
+    std::cout << std::left << std::setw(8) << op
+              << std::right << std::setw(10) << n
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << forward
+              << std::setw(14) << nearest
+              << std::setw(14);
+    if (held < 0) {
+        std::cout << "-";
+    } else {
+        std::cout << held;
+    }
+    std::cout << '\n';
+}
+
+void run(size_t n, size_t ops) {
+    std::mt19937 rng(42);
+    std::vector<size_t> indices(ops);
+    for (size_t& index : indices) index = rng() % n;
+
+    // get
+    List list = make_list(n);
+    long long sum = 0;
+    double forward = measure([&] { for (size_t index : indices) sum += *forward_seek(list, index); });
+    double nearest = measure([&] { for (size_t index : indices) sum += list.get(index); });
+    row("get", n, forward, nearest, -1.0);
+
+    // insert: случайные индексы; для итератора позиция уже известна — только O(1) перелинковка
+    List a = make_list(n);
+    forward = measure([&] { for (size_t index : indices) a.insert(forward_seek(a, index), 0); });
+    List b = make_list(n);
+    nearest = measure([&] { for (size_t index : indices) b.insert(index, 0); });
+    List c = make_list(n);
+    DoublyLinkedListIterator<int> position = forward_seek(c, n / 2);
+    double held = measure([&] { for (size_t i = 0; i < ops; ++i) c.insert(position, 0); });
+    row("insert", n, forward, nearest, held);
+
+    // erase: те же индексы, список после вставок стал длиннее на ops элементов
+    forward = measure([&] { for (size_t index : indices) a.erase(forward_seek(a, index)); });
+    nearest = measure([&] { for (size_t index : indices) b.erase(index); });
+    held = measure([&] { for (size_t i = 0; i < ops; ++i) position = c.erase(position); });
+    row("erase", n, forward, nearest, held);
+    sink = sum;
+}
+
+int main(int argc, char** argv) {
+    int max_exp = argc > 1 ? std::atoi(argv[1]) : 6;
+    size_t ops = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+    std::cout << ops << " random-index operations, ms\n";
+    std::cout << std::left << std::setw(8) << "op"
+              << std::right << std::setw(10) << "n"
+              << std::setw(14) << "from head"
+              << std::setw(14) << "nearest end"
+              << std::setw(14) << "iterator" << '\n';
+    size_t n = 10000;
+    for (int e = 4; e <= max_exp; ++e, n *= 10) {
+        run(n, ops);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Сохранение и загрузка DynamicArray<double>: текст (operator<< / operator>> по элементу, как print())
+// против двоичного формата (save_binary одним writev, MappedArray через mmap, load_binary).
+// Для MappedArray отдельно показано время открытия и первого полного обхода.
+// Использование: serialize_bench [max_exp] [dir]  (N = 10^5 .. 10^max_exp, по умолчанию 7; dir — /tmp)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "DynamicArray.h"
+#include "MappedArray.h"
+
+static volatile double sink; // не дает компилятору выбросить результаты
+
+template <typename F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename A, typename B>
+void check_equal(const A& a, const B& b, const char* what) {
+    bool same = a.size() == b.size();
+    for (size_t i = 0; same && i < a.size(); ++i) same = a[i] == b[i];
+    if (!same) {
+        std::cerr << "mismatch after " << what << '\n';
+        std::exit(1);
+    }
+}
+
+void print_row(const char* name, size_t n, double ms) {
+    std::cout << std::left << std::setw(22) << name << std::right << std::setw(10) << n
+              << std::fixed << std::setprecision(3) << std::setw(14) << ms << '\n';
+}
+
+int main(int argc, char** argv) {
+    int max_exp = argc > 1 ? std::atoi(argv[1]) : 7;
+    std::string dir = argc > 2 ? argv[2] : "/tmp";
+    std::string text_path = dir + "/serialize_bench.txt";
+    std::string binary_path = dir + "/serialize_bench.bin";
+
+    std::cout << std::left << std::setw(22) << "operation" << std::right << std::setw(10) << "n"
+              << std::setw(14) << "ms" << '\n';
+
+    size_t n = 100000;
+    for (int e = 5; e <= max_exp; ++e, n *= 10) {
+        DynamicArray<double> array(n);
+        for (size_t i = 0; i < n; ++i) array.push_back(static_cast<double>(i) * 0.37 + 1.0 / (i + 1));
+
+        print_row("text save", n, measure_ms([&] {
+            std::ofstream out(text_path);
+            out << std::setprecision(std::numeric_limits<double>::max_digits10);
+            for (double value : array) out << value << ' ';
+        }));
+        DynamicArray<double> text_loaded(0);
+        print_row("text load", n, measure_ms([&] {
+            std::ifstream in(text_path);
+            for (double value; in >> value;) text_loaded.push_back(value);
+        }));
+        check_equal(array, text_loaded, "text load");
+
+        print_row("binary save", n, measure_ms([&] { save_binary(array, binary_path); }));
+        MappedArray<double> mapped;
+        print_row("mapped open", n, measure_ms([&] { mapped = MappedArray<double>(binary_path); }));
+        print_row("mapped first scan", n, measure_ms([&] {
+            double sum = 0;
+            for (double value : mapped) sum += value;
+            sink = sum;
+        }));
+        check_equal(array, mapped, "mapped open");
+        print_row("mapped verify", n, measure_ms([&] {
+            if (!mapped.verify()) {
+                std::cerr << "checksum mismatch\n";
+                std::exit(1);
+            }
+        }));
+        DynamicArray<double> binary_loaded(0);
+        print_row("binary load", n, measure_ms([&] { binary_loaded = load_binary<double>(binary_path); }));
+        check_equal(array, binary_loaded, "binary load");
+    }
+
+    std::remove(text_path.c_str());
+    std::remove(binary_path.c_str());
+    return 0;
+}
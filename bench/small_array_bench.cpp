@@ -0,0 +1,71 @@
+// Миллионы короткоживущих маленьких массивов: создание, k вызовов push_back, копия,
+// перемещение, обход и разрушение. Сравнивает DynamicArray (всегда в куче) и
+// SmallDynamicArray<int, 16> (до 16 элементов во встроенном буфере): время и число выделений.
+// Использование: small_array_bench [arrays]  (по умолчанию 2000000)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+#include "DynamicArray.h"
+#include "Instrumentation.h"
+#include "SmallDynamicArray.h"
+
+static volatile long long sink; // не дает компилятору выбросить результаты
+
+struct BenchTag {};
+using Stats = StatsInstrumentation<BenchTag>;
+
+// Жизнь одного массива; возвращает сумму элементов копии, чтобы сверить результаты
+template <typename Array>
+long long lifetime(size_t k, size_t seed) {
+    Array array;
+    for (size_t i = 0; i < k; ++i) array.push_back(static_cast<int>(seed + i));
+    Array copy(array);
+    Array moved(std::move(array));
+    long long sum = 0;
+    for (int value : copy) sum += value;
+    for (int value : moved) sum -= value;
+    return sum + static_cast<long long>(copy.size());
+}
+
+// Время (нс на массив) для arrays массивов и выделений на массив по отдельному проходу с Stats
+template <typename Plain, typename Counted>
+void measure(const char* name, size_t k, size_t arrays) {
+    long long total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < arrays; ++i) total += lifetime<Plain>(k, i);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    sink = total;
+
+    const size_t counted = 1000;
+    Stats::reset();
+    long long check = 0;
+    for (size_t i = 0; i < counted; ++i) check += lifetime<Counted>(k, i);
+    ContainerStats stats = Stats::snapshot();
+
+    if (total != static_cast<long long>(k * arrays) || check != static_cast<long long>(k * counted)
+        || stats.allocations != stats.deallocations) {
+        std::cerr << "mismatch for " << name << " with k = " << k << '\n';
+        std::exit(1);
+    }
+    std::cout << std::left << std::setw(26) << name << std::right << std::setw(6) << k
+              << std::fixed << std::setprecision(1) << std::setw(12) << ns / arrays
+              << std::setprecision(2) << std::setw(14) << static_cast<double>(stats.allocations) / counted
+              << std::setw(14) << static_cast<double>(stats.bytes_allocated) / counted << '\n';
+}
+
+int main(int argc, char** argv) {
+    size_t arrays = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::cout << arrays << " arrays: push_back k elements, copy, move, scan, destroy\n";
+    std::cout << std::left << std::setw(26) << "container" << std::right << std::setw(6) << "k"
+              << std::setw(12) << "ns/array" << std::setw(14) << "allocs/array" << std::setw(14) << "bytes/array" << '\n';
+
+    for (size_t k : {1, 4, 10, 16, 32}) {
+        measure<DynamicArray<int>, DynamicArray<int, GrowthFactor1_5, Stats>>("DynamicArray", k, arrays);
+        measure<SmallDynamicArray<int, 16>, SmallDynamicArray<int, 16, GrowthFactor1_5, Stats>>("SmallDynamicArray<16>", k, arrays);
+    }
+    return 0;
+}
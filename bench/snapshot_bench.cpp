@@ -0,0 +1,129 @@
+// Снимки для читателей: цикл «снять копию — изменить k элементов — прочитать снимок».
+// Глубокие копии DynamicArray и SinglyLinkedList против CowArray и PersistentList,
+// где копия стоит O(1), а изменения копируют только затронутые чанки или узлы.
+// Последние keep снимков остаются живыми, как у отстающих читателей.
+// Использование: snapshot_bench [n] [cycles]  (по умолчанию n = 1000000, cycles = 50)
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "CowArray.h"
+#include "DynamicArray.h"
+#include "GrowthPolicy.h"
+#include "Instrumentation.h"
+#include "PersistentList.h"
+#include "SinglyLinkedList.h"
+
+struct BenchTag {};
+using Stats = StatsInstrumentation<BenchTag>;
+
+static const size_t keep = 4;     // живых снимков
+static const size_t changes = 16; // изменений за цикл
+
+template <typename F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Изменения, сохраняющие сумму элементов: у массивов — перенос единицы между элементами,
+// у списков — снятие и возврат головы (узел пересоздается)
+template <typename Array>
+void mutate_array(Array& array, std::mt19937& rng) {
+    for (size_t c = 0; c < changes; ++c) {
+        size_t from = rng() % array.size(), to = rng() % array.size();
+        array[from] -= 1;
+        array[to] += 1;
+    }
+}
+
+template <typename List>
+void mutate_list(List& list, std::mt19937&) {
+    for (size_t c = 0; c < changes; ++c) {
+        long value = list.front();
+        list.pop_front();
+        list.push_front(value);
+    }
+}
+
+template <typename Container>
+long long sum(const Container& container) {
+    long long total = 0;
+    for (long value : container) total += value;
+    return total;
+}
+
+struct Row {
+    double snapshot_ms = 0, mutate_ms = 0, read_ms = 0;
+    size_t bytes_per_cycle = 0;
+};
+
+// Plain — для замера времени, Counted — тот же контейнер с Stats для подсчета байт
+template <typename Plain, typename Counted, typename Mutate>
+Row run(size_t n, size_t cycles, Mutate mutate) {
+    Row row;
+    for (int pass = 0; pass < 2; ++pass) {
+        auto body = [&](auto& container) {
+            using Container = std::decay_t<decltype(container)>;
+            std::mt19937 rng(7);
+            for (size_t i = 0; i < n; ++i) container.push_back(1);
+            std::deque<Container> snapshots;
+            size_t before = Stats::snapshot().bytes_allocated;
+            for (size_t c = 0; c < cycles; ++c) {
+                row.snapshot_ms += measure_ms([&] { snapshots.push_back(container); });
+                row.mutate_ms += measure_ms([&] { mutate(container, rng); });
+                long long total = 0;
+                row.read_ms += measure_ms([&] { total = sum(snapshots.back()); });
+                if (total != static_cast<long long>(n)) {
+                    std::cerr << "snapshot changed under reader\n";
+                    std::exit(1);
+                }
+                if (snapshots.size() > keep) snapshots.pop_front();
+            }
+            row.bytes_per_cycle = (Stats::snapshot().bytes_allocated - before) / cycles;
+        };
+        if (pass == 0) {
+            Plain container;
+            body(container);
+        } else { // подсчет байт; время этого прохода не учитывается
+            Row timed = row;
+            Counted container;
+            body(container);
+            size_t bytes = row.bytes_per_cycle;
+            row = timed;
+            row.bytes_per_cycle = bytes;
+        }
+    }
+    row.snapshot_ms /= cycles;
+    row.mutate_ms /= cycles;
+    row.read_ms /= cycles;
+    return row;
+}
+
+void print_row(const char* name, const Row& row) {
+    std::cout << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(14) << row.snapshot_ms << std::setw(12) << row.mutate_ms << std::setw(12) << row.read_ms
+              << std::setw(16) << row.bytes_per_cycle << '\n';
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t cycles = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 50;
+
+    std::cout << "n = " << n << ", " << changes << " changes per cycle, " << keep << " live snapshots; ms per cycle\n";
+    std::cout << std::left << std::setw(26) << "container" << std::right << std::setw(14) << "snapshot"
+              << std::setw(12) << "mutate" << std::setw(12) << "read" << std::setw(16) << "bytes/cycle" << '\n';
+
+    auto arrays = [](auto& array, std::mt19937& rng) { mutate_array(array, rng); };
+    auto lists = [](auto& list, std::mt19937& rng) { mutate_list(list, rng); };
+    print_row("DynamicArray (deep)", run<DynamicArray<long>, DynamicArray<long, GrowthFactor1_5, Stats>>(n, cycles, arrays));
+    print_row("CowArray", run<CowArray<long>, CowArray<long, 1024, Stats>>(n, cycles, arrays));
+    print_row("SinglyLinkedList (deep)", run<SinglyLinkedList<long>, SinglyLinkedList<long, std::allocator<long>, Stats>>(n, cycles, lists));
+    print_row("PersistentList", run<PersistentList<long>, PersistentList<long, Stats>>(n, cycles, lists));
+    return 0;
+}
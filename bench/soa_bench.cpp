@@ -0,0 +1,163 @@
+// Записи {id, timestamp, value, flags}: DynamicArray<Record> (массив структур) против
+// SoADynamicArray (структура массивов). Проходы по одному полю: сумма value, число записей
+// с нулевым flags (у SoA — кернел bulk::count из BulkOps.h) и фильтр id по порогу value
+// с долей совпадений 10% и 50%. Результаты обоих вариантов сверяются.
+// Использование: soa_bench [n] [repeats]  (по умолчанию n = 2000000, repeats = 10)
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "BulkOps.h"
+#include "DynamicArray.h"
+#include "SoADynamicArray.h"
+
+struct Record {
+    uint64_t id;
+    int64_t timestamp;
+    double value;
+    int32_t flags;
+};
+
+using Columns = SoADynamicArray<uint64_t, int64_t, double, int32_t>;
+enum { Id, Timestamp, Value, Flags };
+
+static volatile double sink;
+
+template <typename F>
+double measure_ms(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void check(bool ok, const char* what) {
+    if (!ok) {
+        std::cerr << "mismatch: " << what << '\n';
+        std::exit(1);
+    }
+}
+
+void print_row(const char* name, double aos_ms, double soa_ms) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << aos_ms << std::setw(12) << soa_ms << std::setw(10) << std::setprecision(2)
+              << aos_ms / soa_ms << "x\n";
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    size_t repeats = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10;
+
+    DynamicArray<Record> records;
+    Columns columns;
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    double aos_build = measure_ms([&] {
+        std::mt19937 local(11);
+        for (size_t i = 0; i < n; ++i) {
+            records.push_back(Record{i, static_cast<int64_t>(i * 10), uniform(local), static_cast<int32_t>(local() % 4)});
+        }
+    });
+    double soa_build = measure_ms([&] {
+        std::mt19937 local(11);
+        for (size_t i = 0; i < n; ++i) {
+            double value = uniform(local);
+            columns.push_back(i, static_cast<int64_t>(i * 10), value, static_cast<int32_t>(local() % 4));
+        }
+    });
+    check(columns.size() == records.size(), "size");
+
+    std::cout << "n = " << n << ", sizeof(Record) = " << sizeof(Record) << ", ms per pass (" << repeats
+              << " repeats)\n";
+    std::cout << std::left << std::setw(24) << "operation" << std::right << std::setw(12) << "AoS"
+              << std::setw(12) << "SoA" << std::setw(11) << "speedup" << '\n';
+    print_row("build (push_back)", aos_build, soa_build);
+
+    // Сумма одного поля
+    double aos_sum = 0, soa_sum = 0;
+    double aos_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            double total = 0;
+            for (const Record& record : records) total += record.value;
+            aos_sum = total;
+        }
+    }) / repeats;
+    double soa_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            double total = 0;
+            for (double value : columns.column<Value>()) total += value;
+            soa_sum = total;
+        }
+    }) / repeats;
+    check(aos_sum == soa_sum, "sum(value)");
+    sink = soa_sum;
+    print_row("sum(value)", aos_ms, soa_ms);
+
+    // Подсчет по полю int32: у SoA столбец целиком уходит в векторный кернел
+    size_t aos_count = 0, soa_count = 0;
+    aos_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeats; ++r) {
+            size_t count = 0;
+            for (const Record& record : records) count += record.flags == 0;
+            aos_count = count;
+        }
+    }) / repeats;
+    soa_ms = measure_ms([&] {
+        for (size_t r = 0; r < repeats; ++r) soa_count = bulk::count(columns.column<Flags>(), 0);
+    }) / repeats;
+    check(aos_count == soa_count, "count(flags == 0)");
+    sink = static_cast<double>(soa_count);
+    print_row("count(flags == 0)", aos_ms, soa_ms);
+
+    // Фильтр: id записей с value > threshold. SoA читает столбец value целиком,
+    // а столбец id — только в совпавших строках
+    for (double threshold : {0.9, 0.5}) {
+        DynamicArray<uint64_t> aos_ids, soa_ids;
+        aos_ms = measure_ms([&] {
+            for (size_t r = 0; r < repeats; ++r) {
+                aos_ids.clear();
+                for (const Record& record : records) {
+                    if (record.value > threshold) aos_ids.push_back(record.id);
+                }
+            }
+        }) / repeats;
+        soa_ms = measure_ms([&] {
+            for (size_t r = 0; r < repeats; ++r) {
+                soa_ids.clear();
+                ArrayView<const double> values = columns.column<Value>();
+                ArrayView<const uint64_t> ids = columns.column<Id>();
+                for (size_t i = 0; i < values.size(); ++i) {
+                    if (values[i] > threshold) soa_ids.push_back(ids[i]);
+                }
+            }
+        }) / repeats;
+        check(aos_ids.size() == soa_ids.size(), "filter size");
+        for (size_t i = 0; i < aos_ids.size(); ++i) check(aos_ids[i] == soa_ids[i], "filter ids");
+        sink = static_cast<double>(soa_ids.size());
+        print_row(threshold > 0.6 ? "filter id (10%)" : "filter id (50%)", aos_ms, soa_ms);
+    }
+
+    // Доступ к строке через прокси-ссылку: все поля, как у записи
+    double aos_row = 0, soa_row = 0;
+    aos_ms = measure_ms([&] {
+        for (size_t i = 0; i < n; ++i) {
+            const Record& record = records[i];
+            aos_row += record.value * static_cast<double>(record.timestamp - record.flags);
+        }
+    });
+    soa_ms = measure_ms([&] {
+        const Columns& view = columns;
+        for (size_t i = 0; i < n; ++i) {
+            Columns::const_reference row = view[i];
+            soa_row += row.get<Value>() * static_cast<double>(row.get<Timestamp>() - row.get<Flags>());
+        }
+    });
+    check(aos_row == soa_row, "row access");
+    sink = soa_row;
+    print_row("row access (all fields)", aos_ms, soa_ms);
+
+    return 0;
+}
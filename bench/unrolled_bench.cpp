@@ -0,0 +1,84 @@
+// Сравнение UnrolledList с DynamicArray, SinglyLinkedList и DoublyLinkedList:
+// последовательный обход, вставка по случайному индексу и вставка в середину.
+// Использование: unrolled_bench [n] [k]  (по умолчанию n = 100000, k = 1000)
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+#include "DynamicArray.h"
+#include "SinglyLinkedList.h"
+#include "UnrolledList.h"
+
+static volatile long long sink; // не дает компилятору выбросить обход
+
+template <typename F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Container>
+long long scan(const Container& container) {
+    long long sum = 0;
+    for (int value : container) sum += value;
+    return sum;
+}
+
+template <typename Container>
+void run(const char* name, size_t n, const std::vector<size_t>& positions) {
+    Container container;
+    for (size_t i = 0; i < n; ++i) {
+        container.push_back(static_cast<int>(i));
+    }
+
+    long long sum = 0;
+    double scan_ms = measure([&] { sum = scan(container); });
+
+    double random_ms = measure([&] {
+        for (size_t position : positions) container.insert(position, 1); // позиции не больше n
+    });
+
+    double middle_ms = measure([&] {
+        for (size_t i = 0; i < positions.size(); ++i) container.insert_middle(2);
+    });
+
+    double rescan_ms = measure([&] { sum += scan(container); });
+
+    std::cout << std::left << std::setw(18) << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << scan_ms
+              << std::setw(14) << random_ms
+              << std::setw(14) << middle_ms
+              << std::setw(14) << rescan_ms << '\n';
+    sink = sum;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    size_t k = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+
+    std::mt19937 rng(7);
+    std::vector<size_t> positions(k);
+    for (size_t& position : positions) position = rng() % (n + 1);
+
+    std::cout << "n = " << n << ", k = " << k << " (ms)\n";
+    std::cout << std::left << std::setw(18) << "container"
+              << std::right << std::setw(12) << "scan"
+              << std::setw(14) << "random ins"
+              << std::setw(14) << "middle ins"
+              << std::setw(14) << "scan after" << '\n';
+
+    run<DynamicArray<int>>("DynamicArray", n, positions);
+    run<SinglyLinkedList<int>>("SinglyLinkedList", n, positions);
+    run<DoublyLinkedList<int>>("DoublyLinkedList", n, positions);
+    run<UnrolledList<int, 16>>("UnrolledList<16>", n, positions);
+    run<UnrolledList<int, 64>>("UnrolledList<64>", n, positions);
+    run<UnrolledList<int, 256>>("UnrolledList<256>", n, positions);
+    return 0;
+}
@@ -0,0 +1,4 @@
+# Конфигурация пакета для find_package(containers): цель containers::containers
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
+include("${CMAKE_CURRENT_LIST_DIR}/containersTargets.cmake")
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+// Невладеющее представление непрерывного диапазона элементов: указатель + длина.
+// Копируется дешево, память не освобождает; ArrayView<const T> — только для чтения.
+// Действует, пока жив и не перевыделен контейнер, из которого получено.
+template <typename T>
+class ArrayView {
+private:
+    T* first;
+    size_t count;
+
+public:
+    using value_type = typename std::remove_cv<T>::type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator = T*;
+
+    ArrayView() : first(nullptr), count(0) {}
+    ArrayView(T* pointer, size_t size) : first(pointer), count(size) {}
+
+    // ArrayView<T> приводится к ArrayView<const T>
+    template <typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+    ArrayView(const ArrayView<U>& other) : first(other.data()), count(other.size()) {}
+
+    T* data() const { return first; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // Доступ без проверки границ (проверяется только assert в отладочной сборке)
+    T& operator[](size_t index) const {
+        assert(index < count);
+        return first[index];
+    }
+
+    T& at(size_t index) const {
+        if (index >= count) throw std::out_of_range("Index out of range");
+        return first[index];
+    }
+
+    T& front() const { return (*this)[0]; }
+    T& back() const { return (*this)[count - 1]; }
+
+    iterator begin() const { return first; }
+    iterator end() const { return first + count; }
+
+    // Подпредставление из length элементов начиная с offset
+    ArrayView subview(size_t offset, size_t length) const {
+        if (offset > count || length > count - offset) throw std::out_of_range("Index out of range");
+        return ArrayView(first + offset, length);
+    }
+};
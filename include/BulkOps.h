@@ -0,0 +1,569 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ArrayView.h"
+
+// Пакетные операции над непрерывными массивами арифметических типов
+// (DynamicArray::view(), ArrayView): sum, min_max, find, count, fill, transform, dot.
+// Для int32_t и float есть SSE- и AVX2-версии; нужная выбирается во время
+// выполнения по возможностям процессора. Остальные типы и процессоры без x86
+// используют скалярные циклы.
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BULK_OPS_X86 1
+#include <immintrin.h>
+#define BULK_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BULK_OPS_X86 0
+#endif
+
+namespace bulk {
+
+// Уровень набора инструкций, используемый кернелами
+enum class SimdLevel { Scalar = 0, SSE = 1, AVX2 = 2 };
+
+namespace detail {
+
+inline SimdLevel detect_level() {
+#if BULK_OPS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE;
+#endif
+    return SimdLevel::Scalar;
+}
+
+inline SimdLevel& active_level() {
+    static SimdLevel level = detect_level();
+    return level;
+}
+
+} // namespace detail
+
+// Лучший уровень, поддерживаемый процессором
+inline SimdLevel supported_level() {
+    static const SimdLevel level = detail::detect_level();
+    return level;
+}
+
+// Уровень, который используют кернелы сейчас
+inline SimdLevel simd_level() {
+    return detail::active_level();
+}
+
+// Принудительное ограничение уровня (например, для сравнения в бенчмарке);
+// выше поддерживаемого процессором уровень не поднимается
+inline void set_simd_level(SimdLevel level) {
+    detail::active_level() = level < supported_level() ? level : supported_level();
+}
+
+// Тип результата sum/dot: целые суммируются в 64 бита, чтобы не переполниться
+template <typename T>
+using sum_type = typename std::conditional<
+    std::is_integral<T>::value,
+    typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type,
+    T>::type;
+
+// Скалярные версии: работают для любого арифметического типа
+namespace scalar {
+
+template <typename T>
+sum_type<T> sum(const T* p, size_t n) {
+    sum_type<T> total = 0;
+    for (size_t i = 0; i < n; ++i) total += p[i];
+    return total;
+}
+
+template <typename T>
+std::pair<T, T> min_max(const T* p, size_t n) {
+    T lo = p[0], hi = p[0];
+    for (size_t i = 1; i < n; ++i) {
+        if (p[i] < lo) lo = p[i];
+        if (hi < p[i]) hi = p[i];
+    }
+    return std::make_pair(lo, hi);
+}
+
+template <typename T>
+size_t find(const T* p, size_t n, T value) {
+    for (size_t i = 0; i < n; ++i) {
+        if (p[i] == value) return i;
+    }
+    return n;
+}
+
+template <typename T>
+size_t count(const T* p, size_t n, T value) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) total += p[i] == value;
+    return total;
+}
+
+template <typename T>
+void fill(T* p, size_t n, T value) {
+    for (size_t i = 0; i < n; ++i) p[i] = value;
+}
+
+template <typename T>
+sum_type<T> dot(const T* a, const T* b, size_t n) {
+    sum_type<T> total = 0;
+    for (size_t i = 0; i < n; ++i) total += static_cast<sum_type<T>>(a[i]) * b[i];
+    return total;
+}
+
+template <typename T, typename U, typename Op>
+void transform(const T* src, U* dst, size_t n, Op op) {
+    for (size_t i = 0; i < n; ++i) dst[i] = op(src[i]);
+}
+
+} // namespace scalar
+
+#if BULK_OPS_X86
+
+namespace sse {
+
+BULK_TARGET("sse4.1") inline long long sum(const int32_t* p, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    alignas(16) long long lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + scalar::sum(p + i, n - i);
+}
+
+BULK_TARGET("sse4.1") inline float sum(const float* p, size_t n) {
+    __m128 acc = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) acc = _mm_add_ps(acc, _mm_loadu_ps(p + i));
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::sum(p + i, n - i);
+}
+
+BULK_TARGET("sse4.1") inline std::pair<int32_t, int32_t> min_max(const int32_t* p, size_t n) {
+    if (n < 4) return scalar::min_max(p, n);
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i hi = lo;
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        lo = _mm_min_epi32(lo, v);
+        hi = _mm_max_epi32(hi, v);
+    }
+    alignas(16) int32_t l[4], h[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(l), lo);
+    _mm_store_si128(reinterpret_cast<__m128i*>(h), hi);
+    std::pair<int32_t, int32_t> result = scalar::min_max(l, 4);
+    result.second = scalar::min_max(h, 4).second;
+    for (; i < n; ++i) {
+        if (p[i] < result.first) result.first = p[i];
+        if (result.second < p[i]) result.second = p[i];
+    }
+    return result;
+}
+
+BULK_TARGET("sse4.1") inline std::pair<float, float> min_max(const float* p, size_t n) {
+    if (n < 4) return scalar::min_max(p, n);
+    __m128 lo = _mm_loadu_ps(p);
+    __m128 hi = lo;
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m128 v = _mm_loadu_ps(p + i);
+        lo = _mm_min_ps(lo, v);
+        hi = _mm_max_ps(hi, v);
+    }
+    alignas(16) float l[4], h[4];
+    _mm_store_ps(l, lo);
+    _mm_store_ps(h, hi);
+    std::pair<float, float> result = scalar::min_max(l, 4);
+    result.second = scalar::min_max(h, 4).second;
+    for (; i < n; ++i) {
+        if (p[i] < result.first) result.first = p[i];
+        if (result.second < p[i]) result.second = p[i];
+    }
+    return result;
+}
+
+BULK_TARGET("sse4.1") inline size_t find(const int32_t* p, size_t n, int32_t value) {
+    __m128i needle = _mm_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + scalar::find(p + i, n - i, value);
+}
+
+BULK_TARGET("sse4.1") inline size_t find(const float* p, size_t n, float value) {
+    __m128 needle = _mm_set1_ps(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), needle));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + scalar::find(p + i, n - i, value);
+}
+
+BULK_TARGET("sse4.1") inline size_t count(const int32_t* p, size_t n, int32_t value) {
+    __m128i needle = _mm_set1_epi32(value);
+    __m128i acc = _mm_setzero_si128(); // сравнение дает -1 в совпавших lane, вычитаем
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), needle));
+    }
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3] + scalar::count(p + i, n - i, value);
+}
+
+BULK_TARGET("sse4.1") inline size_t count(const float* p, size_t n, float value) {
+    __m128 needle = _mm_set1_ps(value);
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_sub_epi32(acc, _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(p + i), needle)));
+    }
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3] + scalar::count(p + i, n - i, value);
+}
+
+BULK_TARGET("sse4.1") inline void fill(int32_t* p, size_t n, int32_t value) {
+    __m128i v = _mm_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), v);
+    scalar::fill(p + i, n - i, value);
+}
+
+BULK_TARGET("sse4.1") inline void fill(float* p, size_t n, float value) {
+    __m128 v = _mm_set1_ps(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(p + i, v);
+    scalar::fill(p + i, n - i, value);
+}
+
+BULK_TARGET("sse4.1") inline long long dot(const int32_t* a, const int32_t* b, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        acc = _mm_add_epi64(acc, _mm_mul_epi32(x, y)); // четные lane, произведение в 64 бита
+        acc = _mm_add_epi64(acc, _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32))); // нечетные
+    }
+    alignas(16) long long lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + scalar::dot(a + i, b + i, n - i);
+}
+
+BULK_TARGET("sse4.1") inline float dot(const float* a, const float* b, size_t n) {
+    __m128 acc = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::dot(a + i, b + i, n - i);
+}
+
+} // namespace sse
+
+namespace avx2 {
+
+BULK_TARGET("avx2") inline long long sum(const int32_t* p, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) long long lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::sum(p + i, n - i);
+}
+
+BULK_TARGET("avx2") inline float sum(const float* p, size_t n) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps(); // два аккумулятора скрывают задержку сложения
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(p + i));
+        acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(p + i + 8));
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, _mm256_add_ps(acc0, acc1));
+    float total = 0;
+    for (float lane : lanes) total += lane;
+    return total + scalar::sum(p + i, n - i);
+}
+
+BULK_TARGET("avx2") inline std::pair<int32_t, int32_t> min_max(const int32_t* p, size_t n) {
+    if (n < 8) return scalar::min_max(p, n);
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i hi = lo;
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        lo = _mm256_min_epi32(lo, v);
+        hi = _mm256_max_epi32(hi, v);
+    }
+    alignas(32) int32_t l[8], h[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(l), lo);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(h), hi);
+    std::pair<int32_t, int32_t> result = scalar::min_max(l, 8);
+    result.second = scalar::min_max(h, 8).second;
+    for (; i < n; ++i) {
+        if (p[i] < result.first) result.first = p[i];
+        if (result.second < p[i]) result.second = p[i];
+    }
+    return result;
+}
+
+BULK_TARGET("avx2") inline std::pair<float, float> min_max(const float* p, size_t n) {
+    if (n < 8) return scalar::min_max(p, n);
+    __m256 lo = _mm256_loadu_ps(p);
+    __m256 hi = lo;
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(p + i);
+        lo = _mm256_min_ps(lo, v);
+        hi = _mm256_max_ps(hi, v);
+    }
+    alignas(32) float l[8], h[8];
+    _mm256_store_ps(l, lo);
+    _mm256_store_ps(h, hi);
+    std::pair<float, float> result = scalar::min_max(l, 8);
+    result.second = scalar::min_max(h, 8).second;
+    for (; i < n; ++i) {
+        if (p[i] < result.first) result.first = p[i];
+        if (result.second < p[i]) result.second = p[i];
+    }
+    return result;
+}
+
+BULK_TARGET("avx2") inline size_t find(const int32_t* p, size_t n, int32_t value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + scalar::find(p + i, n - i, value);
+}
+
+BULK_TARGET("avx2") inline size_t find(const float* p, size_t n, float value) {
+    __m256 needle = _mm256_set1_ps(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), needle, _CMP_EQ_OQ));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + scalar::find(p + i, n - i, value);
+}
+
+BULK_TARGET("avx2") inline size_t count(const int32_t* p, size_t n, int32_t value) {
+    __m256i needle = _mm256_set1_epi32(value);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), needle));
+    }
+    alignas(32) uint32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    size_t total = 0;
+    for (uint32_t lane : lanes) total += lane;
+    return total + scalar::count(p + i, n - i, value);
+}
+
+BULK_TARGET("avx2") inline size_t count(const float* p, size_t n, float value) {
+    __m256 needle = _mm256_set1_ps(value);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(p + i), needle, _CMP_EQ_OQ);
+        acc = _mm256_sub_epi32(acc, _mm256_castps_si256(eq));
+    }
+    alignas(32) uint32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    size_t total = 0;
+    for (uint32_t lane : lanes) total += lane;
+    return total + scalar::count(p + i, n - i, value);
+}
+
+BULK_TARGET("avx2") inline void fill(int32_t* p, size_t n, int32_t value) {
+    __m256i v = _mm256_set1_epi32(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), v);
+    scalar::fill(p + i, n - i, value);
+}
+
+BULK_TARGET("avx2") inline void fill(float* p, size_t n, float value) {
+    __m256 v = _mm256_set1_ps(value);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) _mm256_storeu_ps(p + i, v);
+    scalar::fill(p + i, n - i, value);
+}
+
+BULK_TARGET("avx2") inline long long dot(const int32_t* a, const int32_t* b, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(x, y)); // четные lane, произведение в 64 бита
+        acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32))); // нечетные
+    }
+    alignas(32) long long lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar::dot(a + i, b + i, n - i);
+}
+
+BULK_TARGET("avx2") inline float dot(const float* a, const float* b, size_t n) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+    }
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, _mm256_add_ps(acc0, acc1));
+    float total = 0;
+    for (float lane : lanes) total += lane;
+    return total + scalar::dot(a + i, b + i, n - i);
+}
+
+// Произвольная операция: тот же скалярный цикл, но скомпилированный с AVX2,
+// чтобы компилятор мог его автовекторизовать
+template <typename T, typename U, typename Op>
+BULK_TARGET("avx2") void transform(const T* src, U* dst, size_t n, Op op) {
+    for (size_t i = 0; i < n; ++i) dst[i] = op(src[i]);
+}
+
+} // namespace avx2
+
+#endif // BULK_OPS_X86
+
+namespace detail {
+
+// Есть ли для типа векторные кернелы
+template <typename T>
+struct has_simd_kernels
+    : std::integral_constant<bool, std::is_same<T, int32_t>::value || std::is_same<T, float>::value> {};
+
+} // namespace detail
+
+// Вызов версии, соответствующей активному уровню
+#if BULK_OPS_X86
+#define BULK_DISPATCH(T, call)                                        \
+    do {                                                              \
+        if constexpr (detail::has_simd_kernels<T>::value) {           \
+            switch (simd_level()) {                                   \
+            case SimdLevel::AVX2: return avx2::call;                  \
+            case SimdLevel::SSE: return sse::call;                    \
+            default: break;                                           \
+            }                                                         \
+        }                                                             \
+        return scalar::call;                                          \
+    } while (false)
+#else
+#define BULK_DISPATCH(T, call) return scalar::call
+#endif
+
+// Сумма элементов (целые — в 64 бита)
+template <typename E>
+sum_type<typename std::remove_const<E>::type> sum(ArrayView<E> values) {
+    using T = typename std::remove_const<E>::type;
+    static_assert(std::is_arithmetic<T>::value, "bulk operations require an arithmetic type");
+    const T* p = values.data();
+    size_t n = values.size();
+    BULK_DISPATCH(T, sum(p, n));
+}
+
+// Минимум и максимум за один проход
+template <typename E>
+std::pair<typename std::remove_const<E>::type, typename std::remove_const<E>::type> min_max(ArrayView<E> values) {
+    using T = typename std::remove_const<E>::type;
+    static_assert(std::is_arithmetic<T>::value, "bulk operations require an arithmetic type");
+    if (values.empty()) throw std::out_of_range("Array is empty");
+    const T* p = values.data();
+    size_t n = values.size();
+    BULK_DISPATCH(T, min_max(p, n));
+}
+
+// Индекс первого элемента, равного value, или size(), если такого нет
+template <typename E>
+size_t find(ArrayView<E> values, typename std::remove_const<E>::type value) {
+    using T = typename std::remove_const<E>::type;
+    static_assert(std::is_arithmetic<T>::value, "bulk operations require an arithmetic type");
+    const T* p = values.data();
+    size_t n = values.size();
+    BULK_DISPATCH(T, find(p, n, value));
+}
+
+// Количество элементов, равных value
+template <typename E>
+size_t count(ArrayView<E> values, typename std::remove_const<E>::type value) {
+    using T = typename std::remove_const<E>::type;
+    static_assert(std::is_arithmetic<T>::value, "bulk operations require an arithmetic type");
+    const T* p = values.data();
+    size_t n = values.size();
+    BULK_DISPATCH(T, count(p, n, value));
+}
+
+// Заполнение всех элементов значением value
+template <typename T>
+void fill(ArrayView<T> values, typename std::remove_const<T>::type value) {
+    static_assert(!std::is_const<T>::value, "cannot fill a read-only view");
+    static_assert(std::is_arithmetic<T>::value, "bulk operations require an arithmetic type");
+    T* p = values.data();
+    size_t n = values.size();
+    BULK_DISPATCH(T, fill(p, n, value));
+}
+
+// Скалярное произведение двух массивов одинаковой длины
+template <typename E1, typename E2>
+sum_type<typename std::remove_const<E1>::type> dot(ArrayView<E1> a, ArrayView<E2> b) {
+    using T = typename std::remove_const<E1>::type;
+    static_assert(std::is_same<T, typename std::remove_const<E2>::type>::value, "dot requires arrays of the same type");
+    static_assert(std::is_arithmetic<T>::value, "bulk operations require an arithmetic type");
+    if (a.size() != b.size()) throw std::invalid_argument("Array sizes differ");
+    const T* x = a.data();
+    const T* y = b.data();
+    size_t n = a.size();
+    BULK_DISPATCH(T, dot(x, y, n));
+}
+
+// dst[i] = op(src[i]); dst может совпадать с src
+template <typename E, typename U, typename Op>
+void transform(ArrayView<E> src, ArrayView<U> dst, Op op) {
+    using T = typename std::remove_const<E>::type;
+    static_assert(!std::is_const<U>::value, "cannot write into a read-only view");
+    if (src.size() != dst.size()) throw std::invalid_argument("Array sizes differ");
+    const T* s = src.data();
+    U* d = dst.data();
+    size_t n = src.size();
+#if BULK_OPS_X86 && defined(__OPTIMIZE__)
+    // Без оптимизации op не встраивается, и вызовы из AVX2-кода только замедляют цикл
+    if (simd_level() == SimdLevel::AVX2) {
+        avx2::transform(s, d, n, op);
+        return;
+    }
+#endif
+    scalar::transform(s, d, n, op);
+}
+
+#undef BULK_DISPATCH
+
+} // namespace bulk
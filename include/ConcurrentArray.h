@@ -0,0 +1,287 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DynamicArray.h"
+
+// Массив только для добавления, в который могут одновременно писать несколько потоков.
+// Слот резервируется атомарным fetch_add; память растет сегментами (B, 2B, 4B, ...),
+// поэтому элементы никогда не перемещаются и ссылки на них остаются действительными.
+// Построенный слот писатель отмечает флагом готовности (release-запись). size() возвращает
+// длину непрерывного префикса готовых слотов: проверяет флаги за кэшированной границей
+// committed и сдвигает ее, так что каждый флаг за все время проверяется один раз.
+// Читатели, работающие параллельно с писателями, видят только полностью построенные
+// элементы [0, size()); не ждут ни писатели, ни читатели.
+// Конструктор T не должен бросать исключений: зарезервированный слот нельзя вернуть.
+template <typename T, size_t FirstSegmentLog = 6>
+class ConcurrentArray {
+private:
+    static const size_t first_segment = size_t(1) << FirstSegmentLog;
+    static const size_t max_segments = sizeof(size_t) * 8 - FirstSegmentLog;
+
+    std::atomic<size_t> length; // число зарезервированных слотов
+    mutable std::atomic<size_t> committed; // проверенный префикс готовых слотов, двигает size()
+    std::atomic<T*> segments[max_segments];
+
+    static size_t log2(size_t value) { // номер старшего единичного бита, value > 0
+        return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+    }
+
+    // Сегмент k начинается с индекса B * (2^k - 1) и вмещает B * 2^k элементов
+    static size_t segment_of(size_t index) {
+        return log2(index / first_segment + 1);
+    }
+
+    static size_t segment_begin(size_t segment) {
+        return first_segment * ((size_t(1) << segment) - 1);
+    }
+
+    static size_t segment_size(size_t segment) {
+        return first_segment << segment;
+    }
+
+    // За элементами сегмента в том же блоке лежат флаги готовности слотов
+    static std::atomic<unsigned char>* ready_flags(T* pointer, size_t segment) {
+        return reinterpret_cast<std::atomic<unsigned char>*>(pointer + segment_size(segment));
+    }
+
+    static T* allocate_segment(size_t segment) {
+        size_t count = segment_size(segment);
+        T* pointer = static_cast<T*>(::operator new(count * (sizeof(T) + 1), std::align_val_t(alignof(T))));
+        std::atomic<unsigned char>* flags = ready_flags(pointer, segment);
+        for (size_t i = 0; i < count; ++i) ::new (static_cast<void*>(flags + i)) std::atomic<unsigned char>(0);
+        return pointer;
+    }
+
+    static void deallocate_segment(T* segment) {
+        ::operator delete(segment, std::align_val_t(alignof(T)));
+    }
+
+    // Сегмент выделяет первый обратившийся к нему поток; проигравший гонку освобождает свой
+    T* segment_for_write(size_t segment) {
+        T* pointer = segments[segment].load(std::memory_order_acquire);
+        if (pointer) return pointer;
+        T* fresh = allocate_segment(segment);
+        if (segments[segment].compare_exchange_strong(pointer, fresh, std::memory_order_acq_rel)) return fresh;
+        deallocate_segment(fresh);
+        return pointer;
+    }
+
+    T* slot(size_t index) const {
+        size_t segment = segment_of(index);
+        return segments[segment].load(std::memory_order_acquire) + (index - segment_begin(segment));
+    }
+
+    // Отмечает построенные слоты [first, first + count) готовыми
+    void publish(size_t first, size_t count) {
+        for (size_t index = first; index < first + count;) {
+            size_t segment = segment_of(index);
+            size_t end = std::min(first + count, segment_begin(segment) + segment_size(segment));
+            std::atomic<unsigned char>* flags = ready_flags(segments[segment].load(std::memory_order_relaxed), segment);
+            for (; index < end; ++index) flags[index - segment_begin(segment)].store(1, std::memory_order_release);
+        }
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    ConcurrentArray() : length(0), committed(0) {
+        for (auto& segment : segments) segment.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ConcurrentArray(const ConcurrentArray&) = delete;
+    ConcurrentArray& operator=(const ConcurrentArray&) = delete;
+
+    ~ConcurrentArray() {
+        clear();
+        for (auto& segment : segments) {
+            T* pointer = segment.load(std::memory_order_relaxed);
+            if (pointer) deallocate_segment(pointer);
+        }
+    }
+
+    // Добавление элемента; возвращает его индекс
+    template <typename... Args>
+    size_t emplace_back(Args&&... args) {
+        size_t index = length.fetch_add(1, std::memory_order_relaxed);
+        size_t segment = segment_of(index);
+        T* pointer = segment_for_write(segment) + (index - segment_begin(segment));
+        ::new (static_cast<void*>(pointer)) T(std::forward<Args>(args)...);
+        publish(index, 1);
+        return index;
+    }
+
+    size_t push_back(const T& value) { return emplace_back(value); }
+    size_t push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    // Резервирует count подряд идущих слотов и заполняет их копиями value; возвращает первый индекс
+    size_t grow_by(size_t count, const T& value = T()) {
+        size_t first = length.fetch_add(count, std::memory_order_relaxed);
+        for (size_t index = first; index < first + count;) {
+            size_t segment = segment_of(index);
+            size_t end = std::min(first + count, segment_begin(segment) + segment_size(segment));
+            T* pointer = segment_for_write(segment) + (index - segment_begin(segment));
+            std::uninitialized_fill(pointer, pointer + (end - index), value);
+            index = end;
+        }
+        publish(first, count);
+        return first;
+    }
+
+    // Доступ без проверки границ
+    T& operator[](size_t index) { return *slot(index); }
+    const T& operator[](size_t index) const { return *slot(index); }
+
+    T& at(size_t index) {
+        if (index >= size()) throw std::out_of_range("Index out of range");
+        return *slot(index);
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size()) throw std::out_of_range("Index out of range");
+        return *slot(index);
+    }
+
+    // Число готовых элементов: [0, size()) построены и видны вызывающему потоку
+    size_t size() const {
+        size_t done = committed.load(std::memory_order_acquire);
+        size_t end = done, reserved = length.load(std::memory_order_acquire);
+        while (end < reserved) {
+            size_t segment = segment_of(end);
+            T* pointer = segments[segment].load(std::memory_order_acquire);
+            if (!pointer) break;
+            const std::atomic<unsigned char>* flags = ready_flags(pointer, segment);
+            size_t limit = std::min(reserved, segment_begin(segment) + segment_size(segment));
+            while (end < limit && flags[end - segment_begin(segment)].load(std::memory_order_acquire)) ++end;
+            if (end < limit) break;
+        }
+        // Проигравший гонку за сдвиг границы просто возвращает свой результат
+        while (done < end && !committed.compare_exchange_weak(done, end, std::memory_order_acq_rel,
+                                                              std::memory_order_acquire)) {
+        }
+        return end;
+    }
+    bool empty() const { return size() == 0; }
+
+    // Вызывает f для каждого опубликованного элемента (можно параллельно с писателями);
+    // сегмент проходится как непрерывный блок
+    template <typename F>
+    void for_each(F f) const {
+        size_t n = size();
+        for (size_t segment = 0; segment_begin(segment) < n; ++segment) {
+            const T* pointer = segments[segment].load(std::memory_order_acquire);
+            size_t count = std::min(n - segment_begin(segment), segment_size(segment));
+            for (size_t i = 0; i < count; ++i) f(pointer[i]);
+        }
+    }
+
+    // Перемещает все элементы в конец обычного массива; вызывать, когда писатели завершились
+    template <typename GrowthPolicy, typename Instrumentation>
+    void move_to(DynamicArray<T, GrowthPolicy, Instrumentation>& out) {
+        size_t n = size();
+        out.reserve(out.size() + n);
+        for (size_t segment = 0; segment_begin(segment) < n; ++segment) {
+            T* pointer = segments[segment].load(std::memory_order_relaxed);
+            size_t count = std::min(n - segment_begin(segment), segment_size(segment));
+            out.insert(out.size(), std::make_move_iterator(pointer), std::make_move_iterator(pointer + count));
+        }
+        clear();
+    }
+
+    // Не потокобезопасно: разрушает элементы и сбрасывает флаги,
+    // сегменты остаются для повторного заполнения
+    void clear() {
+        size_t n = length.load(std::memory_order_relaxed);
+        for (size_t segment = 0; segment_begin(segment) < n; ++segment) {
+            T* pointer = segments[segment].load(std::memory_order_relaxed);
+            size_t count = std::min(n - segment_begin(segment), segment_size(segment));
+            if constexpr (!std::is_trivially_destructible<T>::value) {
+                for (size_t i = 0; i < count; ++i) pointer[i].~T();
+            }
+            std::atomic<unsigned char>* flags = ready_flags(pointer, segment);
+            for (size_t i = 0; i < count; ++i) flags[i].store(0, std::memory_order_relaxed);
+        }
+        length.store(0, std::memory_order_relaxed);
+        committed.store(0, std::memory_order_relaxed);
+    }
+};
+
+// Режим с буферами потоков: каждый поток пишет в свой DynamicArray без синхронизации,
+// в конце буферы сливаются в один массив перемещением блоков.
+// Буфер потока находится через thread_local кэш, поэтому local() дешев при повторных вызовах.
+template <typename T>
+class ThreadBufferedArray {
+private:
+    struct Cache { // последний буфер, выданный этому потоку
+        size_t owner_id;
+        DynamicArray<T>* buffer;
+    };
+
+    static std::atomic<size_t>& next_id() {
+        static std::atomic<size_t> id(1);
+        return id;
+    }
+
+    size_t id; // уникален для каждого экземпляра, в отличие от адреса
+    std::mutex mutex;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<DynamicArray<T>>>> buffers;
+
+public:
+    ThreadBufferedArray() : id(next_id().fetch_add(1, std::memory_order_relaxed)) {}
+
+    ThreadBufferedArray(const ThreadBufferedArray&) = delete;
+    ThreadBufferedArray& operator=(const ThreadBufferedArray&) = delete;
+
+    // Буфер вызывающего потока (создается при первом обращении)
+    DynamicArray<T>& local() {
+        thread_local Cache cache = {0, nullptr};
+        if (cache.owner_id == id) return *cache.buffer;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::thread::id self = std::this_thread::get_id();
+        DynamicArray<T>* buffer = nullptr;
+        for (auto& entry : buffers) {
+            if (entry.first == self) buffer = entry.second.get();
+        }
+        if (!buffer) {
+            buffers.emplace_back(self, std::unique_ptr<DynamicArray<T>>(new DynamicArray<T>(0)));
+            buffer = buffers.back().second.get();
+        }
+        cache = Cache{id, buffer};
+        return *buffer;
+    }
+
+    void push_back(const T& value) { local().push_back(value); }
+    void push_back(T&& value) { local().push_back(std::move(value)); }
+
+    // Сливает буферы в один массив (в порядке регистрации потоков) и очищает их;
+    // вызывать, когда писатели завершились
+    DynamicArray<T> merge() {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t total = 0;
+        for (auto& entry : buffers) total += entry.second->size();
+
+        DynamicArray<T> result(0);
+        result.reserve(total);
+        for (auto& entry : buffers) {
+            DynamicArray<T>& buffer = *entry.second;
+            result.insert(result.size(), std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+            buffer.clear();
+        }
+        return result;
+    }
+};
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "HazardPointers.h"
+
+// Узел lock-free списка: как Node<T>, но next атомарный, а значение хранится в сырой
+// памяти — фиктивный узел очереди значения не содержит, а извлеченное значение
+// разрушает тот поток, который его забрал.
+template <typename T>
+class ConcurrentNode {
+private:
+    alignas(T) unsigned char storage[sizeof(T)];
+
+public:
+    std::atomic<ConcurrentNode*> next;
+
+    ConcurrentNode() : next(nullptr) {}
+
+    template <typename... Args>
+    void construct(Args&&... args) {
+        new (storage) T(std::forward<Args>(args)...);
+    }
+
+    T& data() { return *std::launder(reinterpret_cast<T*>(storage)); }
+
+    // Перемещает значение в out и разрушает его в узле
+    void take(T& out) {
+        out = std::move(data());
+        data().~T();
+    }
+};
+
+// Lock-free очередь Майкла–Скотта (FIFO) для нескольких производителей и потребителей.
+// Узлы выделяются через new: NodePool не потокобезопасен. Удаленные узлы
+// освобождаются через указатели опасности (HazardPointers.h).
+template <typename T>
+class LockFreeQueue {
+private:
+    using NodeType = ConcurrentNode<T>;
+
+    alignas(64) std::atomic<NodeType*> head; // фиктивный узел; первое значение — в head->next
+    alignas(64) std::atomic<NodeType*> tail; // последний или предпоследний узел
+
+public:
+    LockFreeQueue() {
+        NodeType* dummy = new NodeType();
+        head.store(dummy, std::memory_order_relaxed);
+        tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // Деструктор вызывается, когда другие потоки уже не обращаются к очереди
+    ~LockFreeQueue() {
+        NodeType* node = head.load(std::memory_order_relaxed);
+        NodeType* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        while (next) {
+            node = next;
+            next = node->next.load(std::memory_order_relaxed);
+            node->data().~T();
+            delete node;
+        }
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        NodeType* node = new NodeType();
+        node->construct(std::forward<Args>(args)...);
+
+        HazardPointers& hp = HazardPointers::instance();
+        for (;;) {
+            NodeType* last = hp.protect(0, tail);
+            NodeType* next = last->next.load(std::memory_order_acquire);
+            if (last != tail.load(std::memory_order_acquire)) continue;
+            if (next) { // хвост отстал — помогаем его продвинуть
+                tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (last->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed)) {
+                tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        }
+        hp.clear(0);
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    // Извлекает первый элемент в out; false, если очередь пуста
+    bool try_pop(T& out) {
+        HazardPointers& hp = HazardPointers::instance();
+        for (;;) {
+            NodeType* first = hp.protect(0, head);
+            NodeType* last = tail.load(std::memory_order_acquire);
+            NodeType* next = hp.protect(1, first->next);
+            if (first != head.load(std::memory_order_acquire)) continue;
+            if (!next) {
+                hp.clear(0);
+                hp.clear(1);
+                return false;
+            }
+            if (first == last) { // хвост отстал — помогаем его продвинуть
+                tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (head.compare_exchange_weak(first, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                // next стал фиктивным узлом; его значение доступно только победителю CAS
+                next->take(out);
+                hp.clear(0);
+                hp.clear(1);
+                hp.retire(first);
+                return true;
+            }
+        }
+    }
+
+    // Результат может устареть сразу после возврата
+    bool empty() const {
+        return head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+// Lock-free стек Трайбера (LIFO) для нескольких производителей и потребителей.
+// Указатели опасности заодно исключают ABA: узел не переиспользуется, пока защищен.
+template <typename T>
+class LockFreeStack {
+private:
+    using NodeType = ConcurrentNode<T>;
+
+    std::atomic<NodeType*> top;
+
+public:
+    LockFreeStack() : top(nullptr) {}
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    ~LockFreeStack() {
+        NodeType* node = top.load(std::memory_order_relaxed);
+        while (node) {
+            NodeType* next = node->next.load(std::memory_order_relaxed);
+            node->data().~T();
+            delete node;
+            node = next;
+        }
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        NodeType* node = new NodeType();
+        node->construct(std::forward<Args>(args)...);
+        NodeType* first = top.load(std::memory_order_relaxed);
+        do {
+            node->next.store(first, std::memory_order_relaxed);
+        } while (!top.compare_exchange_weak(first, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    // Извлекает верхний элемент в out; false, если стек пуст
+    bool try_pop(T& out) {
+        HazardPointers& hp = HazardPointers::instance();
+        for (;;) {
+            NodeType* first = hp.protect(0, top);
+            if (!first) {
+                hp.clear(0);
+                return false;
+            }
+            NodeType* next = first->next.load(std::memory_order_relaxed);
+            if (top.compare_exchange_weak(first, next, std::memory_order_acquire, std::memory_order_relaxed)) {
+                hp.clear(0);
+                first->take(out);
+                hp.retire(first);
+                return true;
+            }
+        }
+    }
+
+    bool empty() const {
+        return top.load(std::memory_order_acquire) == nullptr;
+    }
+};
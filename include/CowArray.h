@@ -0,0 +1,379 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.h"
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+// Массив с копированием при записи (copy-on-write). Элементы лежат в чанках по ChunkSize,
+// указатели на чанки — в таблице; и чанки, и таблица разделяются между копиями со счетчиком ссылок.
+// Копия (снимок) стоит O(1): увеличивается счетчик таблицы. Первая запись в разделяемый массив
+// копирует таблицу указателей (n / ChunkSize указателей), затем копируется только тот чанк,
+// в который идет запись, — остальные чанки по-прежнему общие со снимками.
+// Счетчики атомарные: снимок можно отдать другому потоку и читать, пока исходный массив
+// меняется. Сам объект CowArray потокобезопасен не больше, чем DynamicArray.
+template <typename T, size_t ChunkSize = 1024, typename Instrumentation = NoInstrumentation>
+class CowArray {
+    static_assert(ChunkSize > 0, "Chunk size must be positive");
+
+private:
+    struct Chunk {
+        std::atomic<size_t> refs;
+        size_t count;
+        alignas(T) unsigned char storage[sizeof(T) * ChunkSize];
+
+        Chunk() : refs(1), count(0) {}
+
+        T* items() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* items() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    struct Table { // память под указатели на чанки в статистику не входит
+        std::atomic<size_t> refs;
+        DynamicArray<Chunk*> chunks;
+
+        explicit Table(size_t capacity) : refs(1), chunks(capacity) {}
+    };
+
+    Table* table; // nullptr у пустого массива
+    size_t length;
+
+    static Chunk* new_chunk() {
+        Chunk* chunk = new Chunk();
+        Instrumentation::on_allocate(sizeof(Chunk));
+        return chunk;
+    }
+
+    static void release(Chunk* chunk) {
+        if (chunk->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < chunk->count; ++i) chunk->items()[i].~T();
+        }
+        delete chunk;
+        Instrumentation::on_deallocate(sizeof(Chunk));
+    }
+
+    static void release(Table* table) {
+        if (!table || table->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        for (Chunk* chunk : table->chunks) release(chunk);
+        delete table;
+        Instrumentation::on_deallocate(sizeof(Table));
+    }
+
+    static bool unique(const std::atomic<size_t>& refs) {
+        return refs.load(std::memory_order_acquire) == 1; // acquire: записи бывших владельцев видны
+    }
+
+    // Своя таблица: разделяемая копируется, чанки в ней остаются общими
+    void detach_table() {
+        if (!table) {
+            table = new Table(4);
+            Instrumentation::on_allocate(sizeof(Table));
+            return;
+        }
+        if (unique(table->refs)) return;
+        size_t count = table->chunks.size();
+        Table* copy = new Table(count + 1);
+        Instrumentation::on_allocate(sizeof(Table));
+        for (Chunk* chunk : table->chunks) {
+            chunk->refs.fetch_add(1, std::memory_order_relaxed);
+            copy->chunks.push_back(chunk);
+        }
+        release(table);
+        table = copy;
+    }
+
+    // Чанк c, доступный для записи; таблица уже своя
+    Chunk* writable_chunk(size_t c) {
+        Chunk*& chunk = table->chunks[c];
+        if (unique(chunk->refs)) return chunk;
+        typename Instrumentation::Scope scope(Operation::Copy);
+        Chunk* copy = new_chunk();
+        try {
+            for (; copy->count < chunk->count; ++copy->count) {
+                ::new (static_cast<void*>(copy->items() + copy->count)) T(chunk->items()[copy->count]);
+            }
+        } catch (...) {
+            release(copy);
+            throw;
+        }
+        Instrumentation::on_copy(chunk->count);
+        release(chunk);
+        chunk = copy;
+        return chunk;
+    }
+
+    // Последний чанк для записи (новый, если последний заполнен)
+    Chunk* writable_back() {
+        detach_table();
+        if (length % ChunkSize == 0) {
+            Chunk* chunk = new_chunk();
+            try {
+                table->chunks.push_back(chunk);
+            } catch (...) {
+                release(chunk);
+                throw;
+            }
+            return chunk;
+        }
+        return writable_chunk(table->chunks.size() - 1);
+    }
+
+    const T& element(size_t index) const {
+        return table->chunks[index / ChunkSize]->items()[index % ChunkSize];
+    }
+
+    // Адрес элемента index или nullptr за концом массива (для итератора)
+    const T* locate(size_t index) const {
+        return index < length ? &element(index) : nullptr;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    // Итератор только для чтения: запись идет через operator[] или set().
+    // Хранит указатель на текущий элемент, чтобы ++ не искал чанк делением
+    class const_iterator {
+    private:
+        const CowArray* array;
+        size_t index;
+        const T* current;
+
+        const_iterator(const CowArray* owner, size_t position, const T* element)
+            : array(owner), index(position), current(element) {}
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() : array(nullptr), index(0), current(nullptr) {}
+        const_iterator(const CowArray* owner, size_t position)
+            : array(owner), index(position), current(owner->locate(position)) {}
+
+        reference operator*() const { return *current; }
+        pointer operator->() const { return current; }
+        reference operator[](difference_type n) const { return array->element(index + n); }
+
+        const_iterator& operator++() {
+            ++current;
+            if (++index % ChunkSize == 0) current = array->locate(index); // переход в следующий чанк
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+        const_iterator& operator--() { return *this -= 1; }
+        const_iterator operator--(int) { const_iterator old = *this; --*this; return old; }
+        const_iterator& operator+=(difference_type n) {
+            index += n;
+            current = array->locate(index);
+            return *this;
+        }
+        const_iterator& operator-=(difference_type n) { return *this += -n; }
+        const_iterator operator+(difference_type n) const { const_iterator it = *this; return it += n; }
+        friend const_iterator operator+(difference_type n, const const_iterator& it) { return it + n; }
+        const_iterator operator-(difference_type n) const { const_iterator it = *this; return it -= n; }
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+        bool operator<(const const_iterator& other) const { return index < other.index; }
+        bool operator>(const const_iterator& other) const { return index > other.index; }
+        bool operator<=(const const_iterator& other) const { return index <= other.index; }
+        bool operator>=(const const_iterator& other) const { return index >= other.index; }
+    };
+    using iterator = const_iterator;
+
+    CowArray() : table(nullptr), length(0) {}
+
+    ~CowArray() { release(table); }
+
+    // Снимок за O(1)
+    CowArray(const CowArray& other) : table(other.table), length(other.length) {
+        if (table) table->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CowArray(CowArray&& other) noexcept : table(other.table), length(other.length) {
+        other.table = nullptr;
+        other.length = 0;
+    }
+
+    CowArray& operator=(const CowArray& other) {
+        if (other.table) other.table->refs.fetch_add(1, std::memory_order_relaxed);
+        release(table);
+        table = other.table;
+        length = other.length;
+        return *this;
+    }
+
+    CowArray& operator=(CowArray&& other) noexcept {
+        if (this == &other) return *this;
+        release(table);
+        table = std::exchange(other.table, nullptr);
+        length = std::exchange(other.length, 0);
+        return *this;
+    }
+
+    // Явный снимок — то же, что копия
+    CowArray snapshot() const { return *this; }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        T value(std::forward<Args>(args)...); // args могут ссылаться на элементы, которые копирование чанка переместит
+        Chunk* chunk = writable_back();
+        T* slot = chunk->items() + chunk->count;
+        ::new (static_cast<void*>(slot)) T(std::move(value));
+        ++chunk->count;
+        ++length;
+        return *slot;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        detach_table();
+        size_t last = table->chunks.size() - 1;
+        Chunk* chunk = table->chunks[last];
+        if (chunk->count == 1) { // чанк пустеет — отпускаем, не копируя
+            table->chunks.erase(last);
+            release(chunk);
+        } else {
+            chunk = writable_chunk(last);
+            chunk->items()[--chunk->count].~T();
+        }
+        --length;
+    }
+
+    // Вставка со сдвигом хвоста: копируются все чанки от index до конца
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Insert);
+        T copy(value);
+        if (index == length) {
+            emplace_back(std::move(copy));
+            return;
+        }
+        emplace_back(std::move((*this)[length - 1]));
+        Instrumentation::on_move(length - 1 - index);
+        for (size_t i = length - 2; i > index; --i) (*this)[i] = std::move((*this)[i - 1]);
+        (*this)[index] = std::move(copy);
+    }
+
+    void insert_middle(const T& value) {
+        insert(length / 2, value);
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        Instrumentation::on_move(length - 1 - index);
+        for (size_t i = index; i + 1 < length; ++i) (*this)[i] = std::move((*this)[i + 1]);
+        pop_back();
+    }
+
+    // Доступ на запись: если чанк элемента разделяется со снимками, сначала копируется чанк.
+    // Копирование происходит и при чтении через неконстантный массив — читать лучше через get() или const&
+    T& operator[](size_t index) {
+        assert(index < length);
+        detach_table();
+        return writable_chunk(index / ChunkSize)->items()[index % ChunkSize];
+    }
+
+    const T& operator[](size_t index) const {
+        assert(index < length);
+        return element(index);
+    }
+
+    T& at(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return element(index);
+    }
+
+    const T& get(size_t index) const { return at(index); }
+
+    void set(size_t index, const T& value) { at(index) = value; }
+
+    const T& front() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return element(0);
+    }
+
+    const T& back() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return element(length - 1);
+    }
+
+    void clear() {
+        release(table);
+        table = nullptr;
+        length = 0;
+    }
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    // true, если хранилище (таблица) разделяется с другим массивом
+    bool is_shared() const { return table && !unique(table->refs); }
+
+    // Число чанков, общих с другими массивами (для статистики)
+    size_t shared_chunks() const {
+        size_t shared = 0;
+        if (table) {
+            for (const Chunk* chunk : table->chunks) shared += !unique(chunk->refs);
+        }
+        return shared;
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, length); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // Обход по чанкам без деления на каждом элементе: f(element)
+    template <typename F>
+    void for_each(F f) const {
+        if (!table) return;
+        for (const Chunk* chunk : table->chunks) {
+            for (size_t i = 0; i < chunk->count; ++i) f(chunk->items()[i]);
+        }
+    }
+
+    void print() const {
+        bool first = true;
+        for_each([&first](const T& value) {
+            std::cout << (first ? "" : ", ") << value;
+            first = false;
+        });
+        std::cout << std::endl;
+    }
+
+    // Буферизованный вывод (см. OutputFormat.h)
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};
@@ -0,0 +1,440 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Instrumentation.h"
+#include "MutationBatch.h"
+#include "NodePool.h"
+#include "OutputFormat.h"
+
+template <typename T>
+class DoublyNode { // Шаблонный класс для узла двусвязного списка
+public:
+    T data; // Данные, хранящиеся в узле
+    DoublyNode* next; // Указатель на следующий узел
+    DoublyNode* prev; // Указатель на предыдущий узел
+
+    // Конструктор, инициализирующий данные и устанавливающий указатели на nullptr
+    DoublyNode(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+    DoublyNode(T&& value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+};
+
+// Двунаправленный итератор двусвязного списка; Const = true — итератор только для чтения.
+// end() хранит nullptr и адрес указателя на хвост списка, поэтому от end() можно сделать --.
+template <typename T, bool Const = false>
+class DoublyLinkedListIterator { // Шаблонный класс для итератора двусвязного списка
+private:
+    template <typename, typename, typename> friend class DoublyLinkedList;
+    template <typename, bool> friend class DoublyLinkedListIterator;
+
+    using NodePtr = typename std::conditional<Const, const DoublyNode<T>*, DoublyNode<T>*>::type;
+
+    NodePtr current; // Указатель на текущий узел
+    DoublyNode<T>* const* tail; // Адрес указателя на последний узел списка
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+
+    DoublyLinkedListIterator() : current(nullptr), tail(nullptr) {}
+
+    // Конструктор, принимающий указатель на узел и адрес хвоста списка
+    explicit DoublyLinkedListIterator(NodePtr node, DoublyNode<T>* const* list_tail = nullptr)
+        : current(node), tail(list_tail) {}
+
+    // Неконстантный итератор приводится к константному
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    DoublyLinkedListIterator(const DoublyLinkedListIterator<T, OtherConst>& other)
+        : current(other.current), tail(other.tail) {}
+
+    // Оператор разыменования для доступа к данным текущего узла
+    reference operator*() const {
+        return current->data; // Возвращает ссылку на данные текущего узла
+    }
+
+    pointer operator->() const {
+        return &current->data;
+    }
+
+    // Префиксный инкремент (перемещение к следующему узлу)
+    DoublyLinkedListIterator& operator++() { 
+        current = current->next; // Переходим к следующему узлу
+        return *this; // Возвращаем текущий итератор для цепочки вызовов
+    }
+
+    // Постфиксный инкремент
+    DoublyLinkedListIterator operator++(int) {
+        DoublyLinkedListIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    // Префиксный декремент (перемещение к предыдущему узлу)
+    DoublyLinkedListIterator& operator--() { 
+        current = current ? current->prev : *tail; // С end() переходим на последний узел
+        return *this; // Возвращаем текущий итератор для цепочки вызовов
+    }
+
+    // Постфиксный декремент
+    DoublyLinkedListIterator operator--(int) {
+        DoublyLinkedListIterator old = *this;
+        --*this;
+        return old;
+    }
+
+    // Сравнение двух итераторов на равенство
+    bool operator==(const DoublyLinkedListIterator& other) const {
+        return current == other.current;
+    }
+
+    // Сравнение двух итераторов на неравенство
+    bool operator!=(const DoublyLinkedListIterator& other) const {
+        return current != other.current; // Возвращает true, если указатели на узлы не равны
+    }
+};
+
+// Allocator — аллокатор в стиле std::allocator; узлы выделяются через его rebind к DoublyNode<T>.
+// PoolAllocator (NodePool.h) нарезает узлы из непрерывных чанков вместо new на каждый узел.
+// Instrumentation — счетчики узлов, переходов и задержек (см. Instrumentation.h)
+template <typename T, typename Allocator = std::allocator<T>, typename Instrumentation = NoInstrumentation>
+class DoublyLinkedList {
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<DoublyNode<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    DoublyNode<T>* head; // Указатель на первый элемент
+    DoublyNode<T>* tail; // Указатель на последний элемент
+    size_t length; // Размер списка
+    NodeAllocator alloc; // Аллокатор узлов
+
+    template <typename... Args>
+    DoublyNode<T>* create_node(Args&&... args) {
+        DoublyNode<T>* node = NodeTraits::allocate(alloc, 1);
+        try {
+            NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc, node, 1);
+            throw;
+        }
+        Instrumentation::on_allocate(sizeof(DoublyNode<T>));
+        return node;
+    }
+
+    void destroy_node(DoublyNode<T>* node) {
+        NodeTraits::destroy(alloc, node);
+        NodeTraits::deallocate(alloc, node, 1);
+        Instrumentation::on_deallocate(sizeof(DoublyNode<T>));
+    }
+
+    // Подвешивание узла в конец списка
+    void link_back(DoublyNode<T>* newNode) {
+        if (!head) { 
+            head = tail = newNode; 
+        } else { 
+            tail->next = newNode; 
+            newNode->prev = tail;  
+            tail = newNode; 
+        } 
+        ++length; 
+    }
+
+    // Копирование узлов other в конец списка
+    void copy_from(const DoublyLinkedList& other) {
+        typename Instrumentation::Scope scope(Operation::Copy);
+        Instrumentation::on_copy(other.length);
+        for (DoublyNode<T>* current = other.head; current != nullptr; current = current->next) {
+            link_back(create_node(current->data));
+        }
+    }
+
+    // Освобождение всех узлов
+    void clear_nodes() {
+        while (head) {
+            DoublyNode<T>* temp = head;
+            head = head->next;
+            destroy_node(temp);
+        }
+        tail = nullptr;
+        length = 0;
+    }
+
+    // Поиск узла по индексу с ближайшего конца списка: не больше length / 2 переходов
+    DoublyNode<T>* node_at(size_t index) const {
+        typename Instrumentation::Scope scope(Operation::Seek);
+        Instrumentation::on_hops(index < length / 2 ? index : length - 1 - index);
+        DoublyNode<T>* current;
+        if (index < length / 2) {
+            current = head;
+            for (size_t i = 0; i < index; ++i) current = current->next;
+        } else {
+            current = tail;
+            for (size_t i = length - 1; i > index; --i) current = current->prev;
+        }
+        return current;
+    }
+
+    // Вставка узла node перед узлом position (position != nullptr)
+    void link_before(DoublyNode<T>* position, DoublyNode<T>* node) {
+        node->next = position;      // Устанавливаем указатель next у нового узла 
+        node->prev = position->prev; // Устанавливаем указатель prev у нового узла 
+
+        if (position->prev)//обновление указателя следующего узла предыдущего элемента
+            position->prev->next = node;//если узел не является головой списка мы обновляем указатель у предыдущего
+        else
+            head = node;
+
+        position->prev = node;
+        ++length;
+    }
+
+    // Исключение узла из списка и его удаление
+    void unlink(DoublyNode<T>* current) {
+        if (current->prev)//если у текущего есть предыдущий узел мы обновляем 
+            current->prev->next = current->next;
+
+        if (current->next)//обновление указателя предыдущего узла
+            current->next->prev = current->prev;
+
+        if (current == head)
+            head = current->next;
+
+        if (current == tail)
+            tail = current->prev;
+
+        destroy_node(current);
+
+        --length; 
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using allocator_type = Allocator;
+    using iterator = DoublyLinkedListIterator<T>;
+    using const_iterator = DoublyLinkedListIterator<T, true>;
+
+    explicit DoublyLinkedList(const Allocator& allocator = Allocator())
+        : head(nullptr), tail(nullptr), length(0), alloc(allocator) {}
+
+    ~DoublyLinkedList() {
+        if constexpr (std::is_trivially_destructible<T>::value && is_pool_allocator<NodeAllocator>::value &&
+                      std::is_same<Instrumentation, NoInstrumentation>::value) {
+            if (alloc.exclusive()) return; // пул сам освободит все чанки, обходить узлы не нужно
+        }
+        clear_nodes();
+    }
+
+    DoublyLinkedList(const DoublyLinkedList& other)
+        : head(nullptr), tail(nullptr), length(0),
+          alloc(NodeTraits::select_on_container_copy_construction(other.alloc)) {
+       try {
+           copy_from(other);
+       } catch (...) {
+           clear_nodes();
+           throw;
+       }
+    }
+
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), length(other.length), alloc(std::move(other.alloc)) {
+       other.head = nullptr; // Обнуляем указатели у перемещаемого объекта
+       other.tail = nullptr;
+       other.length = 0;
+    }
+
+   void push_back(const T& value) { 
+       typename Instrumentation::Scope scope(Operation::Append);
+       link_back(create_node(value)); 
+   }
+
+   DoublyLinkedList& operator=(const DoublyLinkedList& other) {
+       if (this == &other) return *this; // Проверка на самоприсваивание
+
+       clear_nodes(); // Освобождаем текущие ресурсы
+       if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+           alloc = other.alloc;
+       }
+
+       copy_from(other);
+       return *this;
+   }
+
+    DoublyLinkedList& operator=(DoublyLinkedList&& other)
+        noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) {
+       if (this == &other) return *this; // Проверка на самоприсваивание
+
+       clear_nodes(); // Освобождаем текущие ресурсы
+       if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+           alloc = std::move(other.alloc);
+       } else if (alloc != other.alloc) { // узлы чужого аллокатора забрать нельзя — копируем
+           for (DoublyNode<T>* current = other.head; current != nullptr; current = current->next) {
+               push_back(std::move(current->data));
+           }
+           return *this;
+       }
+
+       head = other.head; 
+       tail = other.tail; 
+       length = other.length;
+
+       // Обнуляем перемещаемый объект
+       other.head = nullptr; 
+       other.tail = nullptr; 
+       other.length = 0;
+
+       return *this;
+   }
+
+   void push_back(T&& value) { // Добавляем поддержку r-value ссылки для push_back
+       typename Instrumentation::Scope scope(Operation::Append);
+       link_back(create_node(std::move(value))); 
+   }
+
+   void push_front(const T& value) { 
+       typename Instrumentation::Scope scope(Operation::Append);
+       DoublyNode<T>* newNode = create_node(value); 
+       if (!head) { 
+           head = tail = newNode; 
+       } else { 
+           newNode->next = head; 
+           head->prev = newNode;  
+           head = newNode; 
+       } 
+       ++length; 
+   }
+
+   void insert(size_t index, const T& value) { 
+       if (index > length) throw std::out_of_range("Index out of range"); 
+       
+       if (index == 0) { 
+           push_front(value); 
+           return; 
+       } 
+       
+       if (index == length) { 
+           push_back(value); 
+           return; 
+       } 
+
+       typename Instrumentation::Scope scope(Operation::Insert);
+       DoublyNode<T>* current = node_at(index); //перемещаемся к нужному элементу с ближайшего конца
+       link_before(current, create_node(value));
+   }
+
+   // Вставка перед позицией position за O(1); возвращает итератор на новый элемент
+   iterator insert(const_iterator position, const T& value) {
+       if (!position.current) { // end() — вставка в конец
+           push_back(value);
+           return iterator(tail, &tail);
+       }
+       typename Instrumentation::Scope scope(Operation::Insert);
+       DoublyNode<T>* newNode = create_node(value);
+       link_before(const_cast<DoublyNode<T>*>(position.current), newNode);
+       return iterator(newNode, &tail);
+   }
+
+    void insert_middle(const T& value) {
+       size_t middle_index = length / 2; // Вычисляем индекс середины списка
+       insert(middle_index, value); // Вставляем значение в середину
+   }
+
+   void erase(size_t index) { 
+       if (index >= length) throw std::out_of_range("Index out of range"); 
+       
+       typename Instrumentation::Scope scope(Operation::Erase);
+       unlink(node_at(index)); //узел ищется с ближайшего конца списка
+   }
+
+   // Удаление элемента в позиции position за O(1); возвращает итератор на следующий элемент
+   iterator erase(const_iterator position) {
+       if (!position.current) throw std::out_of_range("Iterator out of range");
+       typename Instrumentation::Scope scope(Operation::Erase);
+       DoublyNode<T>* next = position.current->next;
+       unlink(const_cast<DoublyNode<T>*>(position.current));
+       return iterator(next, &tail);
+   }
+
+   // Применение журнала изменений (MutationBatch.h) за один проход от головы; узлы
+   // оставшихся элементов не трогаются. Журнал должен быть записан для текущей длины,
+   // после применения он очищается
+   void apply(MutationBatch<T>&& batch) {
+       if (batch.base_size() != length) throw std::invalid_argument("Batch was recorded for a different size");
+       typename Instrumentation::Scope scope(Operation::Apply);
+       Instrumentation::on_hops(length);
+       DoublyNode<T>* current = head; // следующий необработанный исходный узел
+       size_t position = 0;           // его индекс среди исходных
+       auto drop_until = [&](size_t stop) {
+           for (; position < stop; ++position) {
+               DoublyNode<T>* next = current->next;
+               unlink(current);
+               current = next;
+           }
+       };
+       batch.for_each_segment(
+           [&](size_t start, size_t count) {
+               drop_until(start);
+               for (size_t i = 0; i < count; ++i) current = current->next;
+               position += count;
+           },
+           [&](T& value) {
+               DoublyNode<T>* node = create_node(std::move(value));
+               if (current) link_before(current, node);
+               else link_back(node);
+           });
+       drop_until(batch.base_size());
+       batch.clear(length);
+   }
+
+   void print() const { 
+      DoublyNode<T>* current= head; 
+      while(current != nullptr){ 
+          std::cout << current -> data << " "; 
+          current=current -> next; 
+      } 
+      std::cout << std::endl; 
+   } 
+
+   // Буферизованный вывод (см. OutputFormat.h)
+   template <typename Sink>
+   void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+      write_range(begin(), end(), sink, format);
+   }
+
+   T get(size_t index) const { 
+       if (index >= length) throw std::out_of_range("Index out of range"); 
+
+       return node_at(index)->data; 
+   }
+
+   size_t getSize() const { return length; } 
+
+   Allocator get_allocator() const {
+       return Allocator(alloc);
+   }
+
+   iterator begin() { 
+      return iterator(head, &tail); // Возвращаем итератор на голову 
+   } 
+
+   iterator end() { 
+      return iterator(nullptr, &tail); // Возвращаем итератор на nullptr 
+   } 
+
+   const_iterator begin() const { return const_iterator(head, &tail); }
+   const_iterator end() const { return const_iterator(nullptr, &tail); }
+   const_iterator cbegin() const { return begin(); }
+   const_iterator cend() const { return end(); }
+
+};
@@ -0,0 +1,621 @@
+#pragma once
+
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ArrayView.h"
+#include "GrowthPolicy.h"
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+template <typename T>
+class MutationBatch; // MutationBatch.h
+
+// GrowthPolicy определяет, как увеличивается емкость при заполнении (см. GrowthPolicy.h);
+// Instrumentation — счетчики выделений, перемещений и задержек (см. Instrumentation.h)
+template <typename T, typename GrowthPolicy = GrowthFactor1_5, typename Instrumentation = NoInstrumentation>
+class DynamicArray {
+private:
+    T* elements; // указатель на неинициализированное хранилище под элементы типа T
+    size_t capacity; // текущая емкость массива
+    size_t length; // текущее количество элементов в массиве
+
+    // Тип можно перемещать побайтовым копированием (memcpy/realloc) без вызова конструкторов
+    static constexpr bool trivially_relocatable =
+        std::is_trivially_copyable<T>::value && alignof(T) <= alignof(std::max_align_t);
+    // Для типов с повышенным выравниванием malloc не подходит
+    static constexpr bool over_aligned = alignof(T) > alignof(std::max_align_t);
+
+    // Выделение сырой памяти под n элементов без вызова конструкторов
+    static T* allocate(size_t n) {
+        if (n == 0) return nullptr;
+        if (n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+        void* p;
+        if constexpr (over_aligned) {
+            p = ::operator new(n * sizeof(T), std::align_val_t(alignof(T)));
+        } else {
+            p = std::malloc(n * sizeof(T));
+            if (!p) throw std::bad_alloc();
+        }
+        Instrumentation::on_allocate(n * sizeof(T));
+        return static_cast<T*>(p);
+    }
+
+    // n — емкость освобождаемого буфера (нужна только для статистики)
+    static void deallocate(T* p, size_t n) {
+        if (!p) return;
+        Instrumentation::on_deallocate(n * sizeof(T));
+        if constexpr (over_aligned) {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+        } else {
+            std::free(p);
+        }
+    }
+
+    // Вызов деструкторов для элементов в диапазоне [first, last)
+    static void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) first->~T();
+        }
+    }
+
+    // Метод для изменения емкости массива
+    void reallocate(size_t new_capacity) {
+        Instrumentation::on_reallocate();
+        if constexpr (trivially_relocatable) { // тривиальные типы переносим через realloc без поэлементного прохода
+            if (new_capacity == 0) {
+                deallocate(elements, capacity);
+                elements = nullptr;
+            } else {
+                if (new_capacity > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+                void* p = std::realloc(elements, new_capacity * sizeof(T));
+                if (!p) throw std::bad_alloc();
+                if (elements) Instrumentation::on_deallocate(capacity * sizeof(T));
+                Instrumentation::on_allocate(new_capacity * sizeof(T));
+                Instrumentation::on_move(length);
+                elements = static_cast<T*>(p);
+            }
+            capacity = new_capacity;
+            return;
+        }
+        T* new_data = allocate(new_capacity); // выделяем сырую память с новой емкостью
+        try {
+            std::uninitialized_move(elements, elements + length, new_data); // перемещаем элементы за один проход
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        Instrumentation::on_move(length);
+        destroy(elements, elements + length); // разрушаем перемещенные элементы
+        deallocate(elements, capacity); // освобождаем память старого массива
+        elements = new_data; // перенаправляем указатель на новый массив
+        capacity = new_capacity; // обновляем емкость
+    }
+
+    // Увеличение емкости при заполненном массиве
+    void grow() {
+        reallocate(GrowthPolicy::next_capacity(capacity, length + 1, sizeof(T))); // новую емкость выбирает политика
+    }
+
+    // Сдвиг элементов [index, length) на одну позицию вправо; позиция length должна быть свободна.
+    // После вызова слот index содержит перемещенный (но живой) объект, если index < length.
+    void shift_right(size_t index) {
+        Instrumentation::on_move(length - index);
+        if constexpr (trivially_relocatable) {
+            std::memmove(static_cast<void*>(elements + index + 1), static_cast<const void*>(elements + index),
+                         (length - index) * sizeof(T));
+            return;
+        }
+        ::new (static_cast<void*>(elements + length)) T(std::move(elements[length - 1]));
+        std::move_backward(elements + index, elements + length - 1, elements + length);
+    }
+
+    // Освобождение n неинициализированных слотов начиная с index (емкости должно хватать).
+    // Хвост сдвигается один раз, а не n раз по одной позиции.
+    void open_gap(size_t index, size_t n) {
+        Instrumentation::on_move(length - index);
+        if constexpr (trivially_relocatable) {
+            std::memmove(static_cast<void*>(elements + index + n), static_cast<const void*>(elements + index),
+                         (length - index) * sizeof(T));
+        } else {
+            size_t tail = length - index;
+            size_t m = tail < n ? tail : n; // элементы, которые уезжают в неинициализированную область
+            std::uninitialized_move(elements + length - m, elements + length, elements + length - m + n);
+            std::move_backward(elements + index, elements + length - m, elements + length - m + n);
+            destroy(elements + index, elements + index + m); // в щели остались перемещенные объекты
+        }
+    }
+
+    // Перенос элементов [first, last) в неинициализированную память dest
+    static void relocate(T* first, T* last, T* dest) {
+        Instrumentation::on_move(static_cast<size_t>(last - first));
+        if constexpr (trivially_relocatable) {
+            if (first != last) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                                           (last - first) * sizeof(T));
+        } else {
+            std::uninitialized_move(first, last, dest);
+            destroy(first, last);
+        }
+    }
+
+    // Вставка n элементов на позицию index за один сдвиг хвоста.
+    // fill(dest) создает все n элементов подряд по адресу dest; при исключении
+    // fill сам разрушает уже созданные элементы (как std::uninitialized_copy).
+    template <typename Fill>
+    void insert_n(size_t index, size_t n, Fill fill) {
+        if (n == 0) return;
+        if (length + n > capacity) {
+            // Места не хватает: собираем новый буфер сразу в итоговом порядке
+            size_t new_capacity = GrowthPolicy::next_capacity(capacity, length + n, sizeof(T));
+            Instrumentation::on_reallocate();
+            T* new_data = allocate(new_capacity);
+            try {
+                fill(new_data + index); // при исключении исходный массив не изменен
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            relocate(elements, elements + index, new_data);
+            relocate(elements + index, elements + length, new_data + index + n);
+            deallocate(elements, capacity);
+            elements = new_data;
+            capacity = new_capacity;
+            length += n;
+            return;
+        }
+        open_gap(index, n);
+        try {
+            fill(elements + index);
+        } catch (...) {
+            destroy(elements + index + n, elements + length + n); // хвост теряется, массив остается корректным
+            length = index;
+            throw;
+        }
+        length += n;
+    }
+
+    // Вставка диапазона с однопроходными итераторами: длина заранее неизвестна
+    template <typename InputIt>
+    void insert_range(size_t index, InputIt first, InputIt last, std::input_iterator_tag) {
+        DynamicArray buffer(0);
+        for (; first != last; ++first) buffer.emplace_back(*first);
+        insert_n(index, buffer.length, [&](T* dest) {
+            std::uninitialized_move(buffer.elements, buffer.elements + buffer.length, dest);
+        });
+        Instrumentation::on_move(buffer.length);
+    }
+
+    // Вставка диапазона с прямыми итераторами: длина известна, элементы копируются сразу на место
+    template <typename ForwardIt>
+    void insert_range(size_t index, ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+        size_t n = static_cast<size_t>(std::distance(first, last));
+        insert_n(index, n, [&](T* dest) {
+            std::uninitialized_copy(first, last, dest); // для указателей на тривиальные типы — memmove
+        });
+        Instrumentation::on_copy(n);
+    }
+
+    // Применение журнала без нового буфера (тривиально перемещаемые типы, емкости хватает).
+    // Отрезки, уезжающие влево, переносятся слева направо, уезжающие вправо — справа налево:
+    // так ни один отрезок не затирает еще не перенесенный. Затем вставки пишутся в щели
+    template <typename Batch>
+    void apply_in_place(Batch& batch, size_t new_length) {
+        struct Piece {
+            size_t from, to, count;
+            T* value; // у вставки — значение в журнале
+        };
+        DynamicArray<Piece> pieces(0);
+        size_t to = 0, moved = 0, inserted = 0;
+        batch.for_each_segment(
+            [&](size_t start, size_t count) {
+                pieces.push_back(Piece{start, to, count, nullptr});
+                if (start != to) moved += count;
+                to += count;
+            },
+            [&](T& value) {
+                pieces.push_back(Piece{0, to++, 1, &value});
+                ++inserted;
+            });
+        for (const Piece& piece : pieces) {
+            if (!piece.value && piece.to < piece.from) {
+                std::memmove(static_cast<void*>(elements + piece.to), static_cast<const void*>(elements + piece.from),
+                             piece.count * sizeof(T));
+            }
+        }
+        for (size_t i = pieces.size(); i-- > 0;) {
+            const Piece& piece = pieces[i];
+            if (!piece.value && piece.to > piece.from) {
+                std::memmove(static_cast<void*>(elements + piece.to), static_cast<const void*>(elements + piece.from),
+                             piece.count * sizeof(T));
+            }
+        }
+        for (const Piece& piece : pieces) {
+            if (piece.value) std::memcpy(static_cast<void*>(elements + piece.to), static_cast<const void*>(piece.value), sizeof(T));
+        }
+        Instrumentation::on_move(moved + inserted);
+        length = new_length;
+        batch.clear(length);
+    }
+
+    // Разрушение элементов за позицией new_length
+    void truncate(size_t new_length) {
+        if (new_length < length) {
+            destroy(elements + new_length, elements + length);
+            length = new_length;
+        }
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    // Элементы лежат непрерывно, поэтому итераторами служат обычные указатели (contiguous iterator)
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    // Конструктор, инициализирующий массив с заданной начальной емкостью (по умолчанию 10)
+    DynamicArray(size_t initial_capacity = 10)
+        : elements(allocate(initial_capacity)), capacity(initial_capacity), length(0) {} // память не инициализируется
+
+    ~DynamicArray() { // деструктор для освобождения памяти
+        destroy(elements, elements + length); // разрушаем только существующие элементы
+        deallocate(elements, capacity); // освобождаем память, выделенную под массив
+    }
+
+    // Конструктор копирования
+    DynamicArray(const DynamicArray& other)
+        : elements(allocate(other.capacity)), capacity(other.capacity), length(other.length) { // инициализация с копированием данных из другого массива
+        typename Instrumentation::Scope scope(Operation::Copy);
+        try {
+            std::uninitialized_copy(other.elements, other.elements + length, elements); // копируем элементы сразу в сырую память
+        } catch (...) {
+            deallocate(elements, capacity);
+            throw;
+        }
+        Instrumentation::on_copy(length);
+    }
+
+    // Конструктор перемещения
+    DynamicArray(DynamicArray&& other) noexcept
+        : elements(other.elements), capacity(other.capacity), length(other.length) { // перемещаем данные из другого массива
+        other.elements = nullptr; // обнуляем указатель у перемещаемого объекта, чтобы избежать двойного освобождения памяти
+        other.length = 0; // обнуляем длину перемещаемого объекта
+        other.capacity = 0; // обнуляем емкость перемещаемого объекта
+    }
+
+    // Оператор присваивания копирования
+    DynamicArray& operator=(const DynamicArray& other) {
+        if (this == &other) return *this; // проверка на самоприсваивание
+        typename Instrumentation::Scope scope(Operation::Copy);
+        T* new_data = allocate(other.capacity); // выделяем память для нового массива
+        try {
+            std::uninitialized_copy(other.elements, other.elements + other.length, new_data); // копируем элементы из другого массива
+        } catch (...) {
+            deallocate(new_data, other.capacity);
+            throw;
+        }
+        Instrumentation::on_copy(other.length);
+        destroy(elements, elements + length); // освобождаем старый массив
+        deallocate(elements, capacity);
+        elements = new_data;
+        capacity = other.capacity; // обновляем емкость
+        length = other.length; // обновляем длину
+        return *this; // возвращаем текущий объект для цепочки присваиваний
+    }
+
+    // Оператор присваивания перемещения
+    DynamicArray& operator=(DynamicArray&& other) noexcept {
+        if (this == &other) return *this; // проверка на самоприсваивание
+        destroy(elements, elements + length); // освобождаем старый массив
+        deallocate(elements, capacity);
+        capacity = other.capacity; // обновляем емкость
+        length = other.length; // обновляем длину
+        elements = other.elements; // перенаправляем указатель на данные другого объекта
+
+        other.elements = nullptr; // обнуляем указатель у перемещаемого объекта, чтобы избежать двойного освобождения памяти
+        other.length = 0; // обнуляем длину перемещаемого объекта
+        other.capacity = 0; // обнуляем емкость перемещаемого объекта
+
+        return *this; // возвращаем текущий объект для цепочки присваиваний
+    }
+
+    // Конструирование элемента прямо в конце массива из переданных аргументов
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        if (length == capacity) { // проверка, нужно ли увеличивать размер массива
+            T tmp(std::forward<Args>(args)...); // аргументы могут ссылаться на элементы самого массива
+            grow();
+            ::new (static_cast<void*>(elements + length)) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(elements + length)) T(std::forward<Args>(args)...);
+        }
+        return elements[length++]; // увеличиваем длину массива
+    }
+
+    void push_back(const T& value) { // добавление элемента в конец массива по ссылке (l-value)
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) { // добавление элемента в конец массива по r-value ссылке (перемещение)
+        emplace_back(std::move(value));
+    }
+
+    // Конструирование элемента на позиции index из переданных аргументов
+    template <typename... Args>
+    T& emplace(size_t index, Args&&... args) {
+        if (index > length) throw std::out_of_range("Index out of range"); // проверка на выход за пределы массива
+        if (index == length) return emplace_back(std::forward<Args>(args)...);
+
+        typename Instrumentation::Scope scope(Operation::Insert);
+        T tmp(std::forward<Args>(args)...); // создаем элемент до сдвига: аргументы могут указывать внутрь массива
+        if (length == capacity) {
+            grow();
+        }
+
+        shift_right(index); // сдвигаем элементы вправо для вставки нового элемента
+        if constexpr (trivially_relocatable) {
+            ::new (static_cast<void*>(elements + index)) T(std::move(tmp)); // слот освобожден memmove
+        } else {
+            elements[index] = std::move(tmp); // в слоте остался перемещенный объект
+        }
+        ++length; // увеличиваем длину массива
+        return elements[index];
+    }
+
+    void insert(size_t index, const T& value) {
+        emplace(index, value);
+    }
+
+    // Вставка count копий value на позицию index
+    void insert(size_t index, size_t count, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        if (count == 0) return;
+        typename Instrumentation::Scope scope(Operation::Insert);
+        T tmp(value); // value может ссылаться на элемент самого массива
+        insert_n(index, count, [&](T* dest) {
+            std::uninitialized_fill_n(dest, count, tmp);
+        });
+        Instrumentation::on_copy(count);
+    }
+
+    // Вставка диапазона [first, last) на позицию index; диапазон не должен указывать в этот же массив
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    void insert(size_t index, InputIt first, InputIt last) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Insert);
+        insert_range(index, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    void erase(size_t index) { 
+        if (index >= length) throw std::out_of_range("Index out of range"); 
+        erase(index, index + 1);
+    }
+
+    // Удаление элементов с индексами [first, last) одним сдвигом хвоста
+    void erase(size_t first, size_t last) {
+        if (first > last || last > length) throw std::out_of_range("Index out of range");
+        size_t n = last - first;
+        if (n == 0) return;
+
+        typename Instrumentation::Scope scope(Operation::Erase);
+        Instrumentation::on_move(length - last);
+        if constexpr (trivially_relocatable) {
+            std::memmove(static_cast<void*>(elements + first), static_cast<const void*>(elements + last),
+                         (length - last) * sizeof(T)); // сдвигаем хвост одним блоком
+        } else {
+            std::move(elements + last, elements + length, elements + first); // сдвигаем элементы влево после удаления
+            destroy(elements + length - n, elements + length); // разрушаем освободившиеся последние слоты
+        }
+
+        length -= n; // уменьшаем длину массива 
+    }
+
+    // Удаление всех элементов, удовлетворяющих pred, за один проход; возвращает число удаленных
+    template <typename Predicate>
+    size_t erase_if(Predicate pred) {
+        T* new_end = std::remove_if(elements, elements + length, pred); // уплотняем оставшиеся элементы к началу
+        size_t removed = static_cast<size_t>(elements + length - new_end);
+        truncate(length - removed);
+        return removed;
+    }
+
+    // Применение журнала изменений (MutationBatch.h) одним проходом: сохраненные элементы
+    // и вставки переносятся в новый буфер сразу в итоговом порядке, каждый ровно один раз.
+    // Журнал должен быть записан для текущей длины; после применения он очищается
+    void apply(MutationBatch<T>&& batch) {
+        if (batch.base_size() != length) throw std::invalid_argument("Batch was recorded for a different size");
+        typename Instrumentation::Scope scope(Operation::Apply);
+        size_t new_length = batch.size();
+        if constexpr (trivially_relocatable) {
+            if (new_length <= capacity) {
+                apply_in_place(batch, new_length);
+                return;
+            }
+        }
+        size_t new_capacity =
+            new_length > capacity ? GrowthPolicy::next_capacity(capacity, new_length, sizeof(T)) : capacity;
+        Instrumentation::on_reallocate();
+        T* new_data = allocate(new_capacity);
+        size_t built = 0;
+        try {
+            batch.for_each_segment(
+                [&](size_t start, size_t count) {
+                    if constexpr (trivially_relocatable) {
+                        std::memcpy(static_cast<void*>(new_data + built), static_cast<const void*>(elements + start),
+                                    count * sizeof(T));
+                    } else {
+                        std::uninitialized_move(elements + start, elements + start + count, new_data + built);
+                    }
+                    built += count;
+                },
+                [&](T& value) {
+                    ::new (static_cast<void*>(new_data + built)) T(std::move(value));
+                    ++built;
+                });
+        } catch (...) { // исходный массив цел (часть элементов может остаться перемещенной)
+            destroy(new_data, new_data + built);
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        Instrumentation::on_move(new_length);
+        destroy(elements, elements + length); // удаленные и перемещенные элементы
+        deallocate(elements, capacity);
+        elements = new_data;
+        capacity = new_capacity;
+        length = new_length;
+        batch.clear(length);
+    }
+
+   void insert_middle(const T& value) { 
+       size_t middle_index = length / 2; // вычисляем индекс середины массива 
+       insert(middle_index, value); // вставляем значение в середину 
+   }
+
+   // Резервирование памяти минимум под new_capacity элементов
+   void reserve(size_t new_capacity) {
+       if (new_capacity > capacity) {
+           typename Instrumentation::Scope scope(Operation::Resize);
+           reallocate(new_capacity);
+       }
+   }
+
+   // Изменение количества элементов: новые элементы создаются конструктором по умолчанию
+   void resize(size_t new_length) {
+       typename Instrumentation::Scope scope(Operation::Resize);
+       if (new_length > capacity) reallocate(new_length);
+       for (; length < new_length; ++length) {
+           ::new (static_cast<void*>(elements + length)) T();
+       }
+       truncate(new_length);
+   }
+
+   // Изменение количества элементов: новые элементы копируются из value
+   void resize(size_t new_length, const T& value) {
+       typename Instrumentation::Scope scope(Operation::Resize);
+       if (new_length > capacity) {
+           T tmp(value); // value может ссылаться на элемент самого массива
+           reallocate(new_length);
+           std::uninitialized_fill(elements + length, elements + new_length, tmp);
+           Instrumentation::on_copy(new_length - length);
+           length = new_length;
+       } else if (new_length > length) {
+           std::uninitialized_fill(elements + length, elements + new_length, value);
+           Instrumentation::on_copy(new_length - length);
+           length = new_length;
+       }
+       truncate(new_length);
+   }
+
+   // Удаление всех элементов; емкость сохраняется
+   void clear() {
+       truncate(0);
+   }
+
+   size_t getCapacity() const {
+       return capacity;
+   }
+
+   void shrink_to_fit() { 
+       if (length < capacity) { 
+           typename Instrumentation::Scope scope(Operation::Resize);
+           reallocate(length); // переносим элементы в хранилище размером, равным текущей длине
+       } 
+   }
+
+   // Чтение с проверкой границ; возвращает ссылку, без копирования элемента
+   const T& get(size_t index) const { 
+       if (index >= length) throw std::out_of_range("Index out of range"); 
+       return elements[index]; 
+   }
+
+   size_t size() const { 
+       return length; 
+   }
+
+   bool empty() const {
+       return length == 0;
+   }
+
+   // Доступ без проверки границ для горячих циклов (assert — только в отладочной сборке)
+   T& operator[](size_t index) { 
+       assert(index < length);
+       return elements[index]; 
+   }
+
+   const T& operator[](size_t index) const {
+       assert(index < length);
+       return elements[index];
+   }
+
+   // Доступ с проверкой границ
+   T& at(size_t index) {
+       if (index >= length) throw std::out_of_range("Index out of range"); 
+       return elements[index]; 
+   }
+
+   const T& at(size_t index) const {
+       if (index >= length) throw std::out_of_range("Index out of range");
+       return elements[index];
+   }
+
+   T& front() {
+       if (length == 0) throw std::out_of_range("Array is empty");
+       return elements[0];
+   }
+
+   const T& front() const {
+       if (length == 0) throw std::out_of_range("Array is empty");
+       return elements[0];
+   }
+
+   T& back() {
+       if (length == 0) throw std::out_of_range("Array is empty");
+       return elements[length - 1];
+   }
+
+   const T& back() const {
+       if (length == 0) throw std::out_of_range("Array is empty");
+       return elements[length - 1];
+   }
+
+   // Указатель на непрерывный буфер элементов (например, для SIMD-кернелов)
+   T* data() { return elements; }
+   const T* data() const { return elements; }
+
+   // Невладеющее представление элементов; недействительно после перевыделения памяти
+   ArrayView<T> view() { return ArrayView<T>(elements, length); }
+   ArrayView<const T> view() const { return ArrayView<const T>(elements, length); }
+
+   iterator begin() { return elements; }
+   iterator end() { return elements + length; }
+   const_iterator begin() const { return elements; }
+   const_iterator end() const { return elements + length; }
+   const_iterator cbegin() const { return elements; }
+   const_iterator cend() const { return elements + length; }
+
+   void print() const { 
+       for (size_t i = 0; i < length; ++i) { 
+           std::cout << elements[i] << (i < length - 1 ? ", " : ""); 
+       } 
+       std::cout << std::endl;
+   }
+
+   // Буферизованный вывод в std::ostream, файловый дескриптор или BufferedWriter (см. OutputFormat.h)
+   template <typename Sink>
+   void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+      write_range(begin(), end(), sink, format);
+   }
+};  
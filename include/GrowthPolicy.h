@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+// Политики роста емкости DynamicArray.
+// Политика — любой тип со статическим методом
+//     static size_t next_capacity(size_t current, size_t required, size_t element_size);
+// который возвращает новую емкость не меньше required.
+
+// Геометрический рост: емкость умножается на Num/Den, но не опускается ниже MinCapacity
+template <size_t Num, size_t Den, size_t MinCapacity = 4>
+struct GeometricGrowth {
+    static_assert(Num > Den, "Growth factor must be greater than 1");
+    static_assert(MinCapacity > 0, "Minimum capacity must be positive");
+
+    static size_t next_capacity(size_t current, size_t required, size_t /*element_size*/) {
+        size_t next = current / Den * Num + current % Den * Num / Den; // current * Num / Den без переполнения
+        if (next < current) next = static_cast<size_t>(-1); // переполнение — берем максимум
+        if (next < MinCapacity) next = MinCapacity;
+        return next < required ? required : next;
+    }
+};
+
+using GrowthFactor1_5 = GeometricGrowth<3, 2>; // рост на 50% (поведение по умолчанию)
+using GrowthFactor2 = GeometricGrowth<2, 1>;   // удвоение
+
+// Для больших массивов емкость округляется вверх до целого числа страниц,
+// чтобы realloc мог расширять блок страницами и не оставлять хвостов.
+// До порога Threshold байт используется политика Small.
+template <size_t PageSize = 4096, size_t Threshold = 64 * 1024, typename Small = GrowthFactor1_5>
+struct PageGranularGrowth {
+    static_assert((PageSize & (PageSize - 1)) == 0, "Page size must be a power of two");
+
+    static size_t next_capacity(size_t current, size_t required, size_t element_size) {
+        size_t next = Small::next_capacity(current, required, element_size);
+        if (next * element_size < Threshold) return next;
+        size_t bytes = (next * element_size + PageSize - 1) & ~(PageSize - 1); // округление до страницы
+        return bytes / element_size;
+    }
+};
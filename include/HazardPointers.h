@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// Указатели опасности (hazard pointers, М. Майкл) — безопасное освобождение узлов
+// в lock-free структурах. Перед разыменованием разделяемого указателя поток публикует
+// его в своем слоте; удаленный из структуры узел «списывается» (retire) и освобождается
+// только тогда, когда ни один поток не держит его в слоте.
+class HazardPointers {
+public:
+    static const size_t slots_per_thread = 2; // очереди Майкла–Скотта нужно два слота
+
+private:
+    // Запись потока: слоты опасных указателей. Записи не удаляются до конца программы,
+    // освободившиеся после завершения потока переиспользуются новыми потоками.
+    struct Record {
+        std::atomic<bool> active;
+        std::atomic<const void*> hazards[slots_per_thread];
+        Record* next;
+
+        Record() : active(true), next(nullptr) {
+            for (auto& hazard : hazards) hazard.store(nullptr, std::memory_order_relaxed);
+        }
+    };
+
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    // Состояние потока: его запись и список списанных, но еще не освобожденных узлов
+    struct ThreadState {
+        HazardPointers& domain;
+        Record* record;
+        std::vector<Retired> retired;
+
+        explicit ThreadState(HazardPointers& owner) : domain(owner), record(owner.acquire_record()) {}
+
+        ~ThreadState() {
+            for (auto& hazard : record->hazards) hazard.store(nullptr, std::memory_order_release);
+            domain.scan(retired);
+            if (!retired.empty()) { // то, что еще защищено другими потоками, освободит кто-то другой
+                std::lock_guard<std::mutex> lock(domain.orphans_mutex);
+                domain.orphans.insert(domain.orphans.end(), retired.begin(), retired.end());
+            }
+            record->active.store(false, std::memory_order_release);
+        }
+    };
+
+    std::atomic<Record*> records;
+    std::atomic<size_t> record_count;
+    std::mutex orphans_mutex;     // редкий путь: только при завершении потоков
+    std::vector<Retired> orphans; // узлы, оставшиеся от завершившихся потоков
+
+    HazardPointers() : records(nullptr), record_count(0) {}
+
+    Record* acquire_record() {
+        for (Record* record = records.load(std::memory_order_acquire); record; record = record->next) {
+            bool expected = false;
+            if (!record->active.load(std::memory_order_relaxed) &&
+                record->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return record;
+            }
+        }
+        Record* record = new Record();
+        Record* head = records.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        record_count.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    ThreadState& state() {
+        thread_local ThreadState local(*this);
+        return local;
+    }
+
+    // Освобождает все списанные узлы, которых нет в слотах ни одного потока
+    void scan(std::vector<Retired>& retired) {
+        {
+            std::unique_lock<std::mutex> lock(orphans_mutex, std::try_to_lock);
+            if (lock.owns_lock() && !orphans.empty()) {
+                retired.insert(retired.end(), orphans.begin(), orphans.end());
+                orphans.clear();
+            }
+        }
+
+        std::vector<const void*> protected_pointers;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (Record* record = records.load(std::memory_order_acquire); record; record = record->next) {
+            for (auto& hazard : record->hazards) {
+                const void* pointer = hazard.load(std::memory_order_acquire);
+                if (pointer) protected_pointers.push_back(pointer);
+            }
+        }
+        std::sort(protected_pointers.begin(), protected_pointers.end());
+
+        size_t kept = 0;
+        for (size_t i = 0; i < retired.size(); ++i) {
+            if (std::binary_search(protected_pointers.begin(), protected_pointers.end(), retired[i].pointer)) {
+                retired[kept++] = retired[i];
+            } else {
+                retired[i].deleter(retired[i].pointer);
+            }
+        }
+        retired.resize(kept);
+    }
+
+public:
+    HazardPointers(const HazardPointers&) = delete;
+    HazardPointers& operator=(const HazardPointers&) = delete;
+
+    // Все потоки программы пользуются одним доменом
+    static HazardPointers& instance() {
+        static HazardPointers domain;
+        return domain;
+    }
+
+    ~HazardPointers() { // потоки к этому моменту завершены, слоты пусты
+        for (const Retired& node : orphans) node.deleter(node.pointer);
+        Record* record = records.load(std::memory_order_relaxed);
+        while (record) {
+            Record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    // Публикует значение source в слоте slot и возвращает его; после возврата
+    // узел не будет освобожден, пока слот не очищен или не перезаписан
+    template <typename Node>
+    Node* protect(size_t slot, const std::atomic<Node*>& source) {
+        std::atomic<const void*>& hazard = state().record->hazards[slot];
+        Node* pointer = source.load(std::memory_order_acquire);
+        for (;;) {
+            hazard.store(pointer, std::memory_order_seq_cst);
+            Node* current = source.load(std::memory_order_seq_cst);
+            if (current == pointer) return pointer;
+            pointer = current;
+        }
+    }
+
+    void clear(size_t slot) {
+        state().record->hazards[slot].store(nullptr, std::memory_order_release);
+    }
+
+    // Списывает узел, уже недостижимый из структуры; deleter вызывается позже
+    template <typename Node>
+    void retire(Node* node) {
+        ThreadState& local = state();
+        local.retired.push_back(Retired{node, [](void* pointer) { delete static_cast<Node*>(pointer); }});
+        // Порог пропорционален числу слотов: каждый scan освобождает хотя бы половину списка
+        if (local.retired.size() >= 2 * slots_per_thread * record_count.load(std::memory_order_relaxed) + 64) {
+            scan(local.retired);
+        }
+    }
+};
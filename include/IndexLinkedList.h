@@ -0,0 +1,446 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "GrowthPolicy.h"
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+// Двусвязный список, узлы которого лежат в одном непрерывном массиве и ссылаются друг на друга
+// 32-битными индексами вместо указателей. Удаленные узлы собираются в список свободных и
+// переиспользуются вставками. Для маленьких T узел в 2-3 раза меньше DoublyNode<T> и не платит
+// за заголовок malloc, а обход идет по одной области памяти. compact() переставляет узлы
+// в порядке списка, после чего обход становится последовательным проходом по массиву.
+// Итераторы хранят список и индекс, поэтому переживают перевыделение массива при вставке;
+// недействительными становятся только итераторы на удаленный элемент и все итераторы после compact().
+template <typename T, typename Instrumentation = NoInstrumentation>
+class IndexLinkedList {
+private:
+    static const uint32_t npos = UINT32_MAX; // «нет узла», аналог nullptr
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        uint32_t next; // у свободного узла — следующий свободный
+        uint32_t prev;
+
+        T& value() { return *std::launder(reinterpret_cast<T*>(storage)); }
+        const T& value() const { return *std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    Slot* slots;
+    uint32_t capacity;
+    uint32_t used;      // узлов, выдававшихся хотя бы раз (slots[used..capacity) не тронуты)
+    uint32_t free_head; // голова списка свободных узлов
+    uint32_t head;
+    uint32_t tail;
+    size_t length;
+
+    static Slot* allocate(size_t n) {
+        void* p = ::operator new(n * sizeof(Slot), std::align_val_t(alignof(Slot)));
+        Instrumentation::on_allocate(n * sizeof(Slot));
+        return static_cast<Slot*>(p);
+    }
+
+    static void deallocate(Slot* p, size_t n) {
+        if (!p) return;
+        Instrumentation::on_deallocate(n * sizeof(Slot));
+        ::operator delete(p, std::align_val_t(alignof(Slot)));
+    }
+
+    // Перенос узлов в новый массив емкостью new_capacity с сохранением индексов
+    void reallocate(size_t new_capacity) {
+        Instrumentation::on_reallocate();
+        Slot* new_slots = allocate(new_capacity);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (used) std::memcpy(static_cast<void*>(new_slots), static_cast<const void*>(slots), used * sizeof(Slot));
+        } else {
+            for (uint32_t i = 0; i < used; ++i) { // ссылки копируются у всех узлов, значения — только у живых
+                new_slots[i].next = slots[i].next;
+                new_slots[i].prev = slots[i].prev;
+            }
+            uint32_t i = head;
+            try {
+                for (; i != npos; i = slots[i].next) ::new (static_cast<void*>(new_slots[i].storage)) T(std::move_if_noexcept(slots[i].value()));
+            } catch (...) {
+                for (uint32_t j = head; j != i; j = slots[j].next) new_slots[j].value().~T();
+                deallocate(new_slots, new_capacity);
+                throw;
+            }
+            for (uint32_t j = head; j != npos; j = slots[j].next) slots[j].value().~T();
+        }
+        Instrumentation::on_move(length);
+        deallocate(slots, capacity);
+        slots = new_slots;
+        capacity = static_cast<uint32_t>(new_capacity);
+    }
+
+    // Индекс свободного узла со значением из args; узел еще не связан со списком
+    template <typename... Args>
+    uint32_t create_node(Args&&... args) {
+        if (free_head != npos) {
+            uint32_t index = free_head;
+            ::new (static_cast<void*>(slots[index].storage)) T(std::forward<Args>(args)...);
+            free_head = slots[index].next;
+            return index;
+        }
+        if (used == capacity) {
+            if (capacity == npos) throw std::length_error("IndexLinkedList is full");
+            size_t next = GrowthFactor1_5::next_capacity(capacity, size_t(capacity) + 1, sizeof(Slot));
+            if (next > npos) next = npos; // индекс npos зарезервирован
+            // значение создается до перевыделения: args могут ссылаться на элементы списка
+            T value(std::forward<Args>(args)...);
+            reallocate(next);
+            ::new (static_cast<void*>(slots[used].storage)) T(std::move(value));
+            return used++;
+        }
+        ::new (static_cast<void*>(slots[used].storage)) T(std::forward<Args>(args)...);
+        return used++;
+    }
+
+    void destroy_node(uint32_t index) {
+        slots[index].value().~T();
+        slots[index].next = free_head;
+        free_head = index;
+    }
+
+    void link_back(uint32_t node) {
+        slots[node].next = npos;
+        slots[node].prev = tail;
+        if (tail == npos) head = node;
+        else slots[tail].next = node;
+        tail = node;
+        ++length;
+    }
+
+    void link_front(uint32_t node) {
+        slots[node].prev = npos;
+        slots[node].next = head;
+        if (head == npos) tail = node;
+        else slots[head].prev = node;
+        head = node;
+        ++length;
+    }
+
+    // Вставка узла node перед узлом position (position != npos)
+    void link_before(uint32_t position, uint32_t node) {
+        uint32_t before = slots[position].prev;
+        slots[node].next = position;
+        slots[node].prev = before;
+        if (before == npos) head = node;
+        else slots[before].next = node;
+        slots[position].prev = node;
+        ++length;
+    }
+
+    void unlink(uint32_t node) {
+        uint32_t before = slots[node].prev;
+        uint32_t after = slots[node].next;
+        if (before == npos) head = after;
+        else slots[before].next = after;
+        if (after == npos) tail = before;
+        else slots[after].prev = before;
+        destroy_node(node);
+        --length;
+    }
+
+    // Поиск узла по индексу с ближайшего конца списка
+    uint32_t node_at(size_t index) const {
+        typename Instrumentation::Scope scope(Operation::Seek);
+        Instrumentation::on_hops(index < length / 2 ? index : length - 1 - index);
+        uint32_t current;
+        if (index < length / 2) {
+            current = head;
+            for (size_t i = 0; i < index; ++i) current = slots[current].next;
+        } else {
+            current = tail;
+            for (size_t i = length - 1; i > index; --i) current = slots[current].prev;
+        }
+        return current;
+    }
+
+    // Копия other, сразу упакованная в порядке списка
+    void copy_from(const IndexLinkedList& other) {
+        typename Instrumentation::Scope scope(Operation::Copy);
+        if (other.length > capacity) reallocate(other.length);
+        for (uint32_t i = other.head; i != npos; i = other.slots[i].next) push_back(other.slots[i].value());
+        Instrumentation::on_copy(other.length);
+    }
+
+    void destroy_all() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (uint32_t i = head; i != npos; i = slots[i].next) slots[i].value().~T();
+        }
+    }
+
+    void reset() {
+        slots = nullptr;
+        capacity = used = 0;
+        free_head = head = tail = npos;
+        length = 0;
+    }
+
+    template <bool Const>
+    class Iterator {
+    private:
+        friend class IndexLinkedList;
+        template <bool> friend class Iterator;
+
+        using List = typename std::conditional<Const, const IndexLinkedList*, IndexLinkedList*>::type;
+
+        List list;
+        uint32_t index;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() : list(nullptr), index(npos) {}
+        Iterator(List owner, uint32_t node) : list(owner), index(node) {}
+
+        // Неконстантный итератор приводится к константному
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst>& other) : list(other.list), index(other.index) {}
+
+        reference operator*() const { return list->slots[index].value(); }
+        pointer operator->() const { return &list->slots[index].value(); }
+
+        Iterator& operator++() {
+            index = list->slots[index].next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        Iterator& operator--() { // с end() переходим на последний узел
+            index = index == npos ? list->tail : list->slots[index].prev;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+    };
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    IndexLinkedList() { reset(); }
+
+    ~IndexLinkedList() {
+        destroy_all();
+        deallocate(slots, capacity);
+    }
+
+    IndexLinkedList(const IndexLinkedList& other) {
+        reset();
+        try {
+            copy_from(other);
+        } catch (...) {
+            destroy_all();
+            deallocate(slots, capacity);
+            throw;
+        }
+    }
+
+    IndexLinkedList(IndexLinkedList&& other) noexcept
+        : slots(other.slots), capacity(other.capacity), used(other.used), free_head(other.free_head),
+          head(other.head), tail(other.tail), length(other.length) {
+        other.reset();
+    }
+
+    IndexLinkedList& operator=(const IndexLinkedList& other) {
+        if (this == &other) return *this;
+        clear();
+        copy_from(other);
+        return *this;
+    }
+
+    IndexLinkedList& operator=(IndexLinkedList&& other) noexcept {
+        if (this == &other) return *this;
+        destroy_all();
+        deallocate(slots, capacity);
+        slots = other.slots;
+        capacity = other.capacity;
+        used = other.used;
+        free_head = other.free_head;
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.reset();
+        return *this;
+    }
+
+    void push_back(const T& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        link_back(create_node(value));
+    }
+
+    void push_back(T&& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        link_back(create_node(std::move(value)));
+    }
+
+    void push_front(const T& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        link_front(create_node(value));
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        if (index == 0) {
+            push_front(value);
+            return;
+        }
+        if (index == length) {
+            push_back(value);
+            return;
+        }
+        typename Instrumentation::Scope scope(Operation::Insert);
+        uint32_t position = node_at(index);
+        link_before(position, create_node(value)); // индекс position не меняется при перевыделении
+    }
+
+    // Вставка перед позицией position за O(1); возвращает итератор на новый элемент
+    iterator insert(const_iterator position, const T& value) {
+        if (position.index == npos) {
+            push_back(value);
+            return iterator(this, tail);
+        }
+        typename Instrumentation::Scope scope(Operation::Insert);
+        uint32_t node = create_node(value);
+        link_before(position.index, node);
+        return iterator(this, node);
+    }
+
+    void insert_middle(const T& value) {
+        insert(length / 2, value);
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        unlink(node_at(index));
+    }
+
+    // Удаление элемента в позиции position за O(1); возвращает итератор на следующий элемент
+    iterator erase(const_iterator position) {
+        if (position.index == npos) throw std::out_of_range("Iterator out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        uint32_t next = slots[position.index].next;
+        unlink(position.index);
+        return iterator(this, next);
+    }
+
+    // Резервирование места под capacity узлов без перевыделений
+    void reserve(size_t new_capacity) {
+        if (new_capacity > npos) throw std::length_error("IndexLinkedList is full");
+        if (new_capacity > capacity) {
+            typename Instrumentation::Scope scope(Operation::Resize);
+            reallocate(new_capacity);
+        }
+    }
+
+    // Удаление всех элементов; массив узлов сохраняется для новых вставок
+    void clear() {
+        destroy_all();
+        used = 0;
+        free_head = head = tail = npos;
+        length = 0;
+    }
+
+    // Перекладывает узлы в порядке списка в начало массива (узел i ссылается на i + 1),
+    // свободные узлы исчезают. Делает все итераторы недействительными
+    void compact() {
+        if (capacity == 0) return;
+        typename Instrumentation::Scope scope(Operation::Resize);
+        Instrumentation::on_reallocate();
+        Slot* packed = allocate(capacity);
+        uint32_t count = 0;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            for (uint32_t i = head; i != npos; i = slots[i].next, ++count) {
+                std::memcpy(static_cast<void*>(packed[count].storage), static_cast<const void*>(slots[i].storage), sizeof(T));
+            }
+        } else {
+            try {
+                for (uint32_t i = head; i != npos; i = slots[i].next, ++count) {
+                    ::new (static_cast<void*>(packed[count].storage)) T(std::move_if_noexcept(slots[i].value()));
+                }
+            } catch (...) {
+                for (uint32_t j = 0; j < count; ++j) packed[j].value().~T();
+                deallocate(packed, capacity);
+                throw;
+            }
+            destroy_all();
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            packed[i].next = i + 1 < count ? i + 1 : npos;
+            packed[i].prev = i > 0 ? i - 1 : npos;
+        }
+        Instrumentation::on_move(count);
+        deallocate(slots, capacity);
+        slots = packed;
+        used = count;
+        free_head = npos;
+        head = count ? 0 : npos;
+        tail = count ? count - 1 : npos;
+    }
+
+    void print() const {
+        for (uint32_t i = head; i != npos; i = slots[i].next) {
+            std::cout << slots[i].value() << (slots[i].next != npos ? ", " : "");
+        }
+        std::cout << std::endl;
+    }
+
+    // Буферизованный вывод (см. OutputFormat.h)
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+
+    T get(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return slots[node_at(index)].value();
+    }
+
+    size_t getSize() const { return length; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    size_t getCapacity() const { return capacity; }
+
+    // Байт на один элемент в массиве узлов (без учета свободных узлов)
+    static constexpr size_t node_size() { return sizeof(Slot); }
+
+    iterator begin() { return iterator(this, head); }
+    iterator end() { return iterator(this, npos); }
+    const_iterator begin() const { return const_iterator(this, head); }
+    const_iterator end() const { return const_iterator(this, npos); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+};
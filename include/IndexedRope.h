@@ -0,0 +1,614 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+// Последовательность с доступом по индексу за O(log n): B-дерево (rope), в листьях которого
+// лежат блоки до LeafSize элементов, как узлы UnrolledList, а во внутренних узлах — до 32 детей
+// и число элементов в поддереве каждого из них. Поиск позиции спускается от корня, вычитая
+// размеры поддеревьев; insert/erase сдвигают элементы только внутри одного листа и обновляют
+// счетчики на пути к корню. Листья связаны в двусвязный список — обход идет по блокам подряд.
+// Переполненный лист делится пополам (при вставке в конец полного листа — заводится новый),
+// малозаполненные соседи сливаются при удалении, как в UnrolledList.
+// Instrumentation — счетчики узлов, переходов и задержек (см. Instrumentation.h)
+template <typename T, size_t LeafSize = 64, typename Instrumentation = NoInstrumentation>
+class IndexedRope {
+    static_assert(LeafSize >= 2, "Leaf must hold at least two elements");
+
+private:
+    static const size_t fanout = 32; // детей у внутреннего узла
+
+    struct Inner;
+
+    struct Node {
+        Inner* parent;
+        bool is_leaf;
+
+        explicit Node(bool leaf) : parent(nullptr), is_leaf(leaf) {}
+    };
+
+    struct Leaf : Node {
+        Leaf* prev;
+        Leaf* next;
+        size_t count;
+        alignas(T) unsigned char storage[sizeof(T) * LeafSize];
+
+        Leaf() : Node(true), prev(nullptr), next(nullptr), count(0) {}
+
+        T* items() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* items() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    struct Inner : Node {
+        size_t count; // детей
+        size_t sizes[fanout]; // элементов в поддереве каждого ребенка
+        Node* children[fanout];
+
+        Inner() : Node(false), count(0) {}
+    };
+
+    Node* root; // nullptr у пустой последовательности
+    Leaf* first; // самый левый лист
+    Leaf* last;  // самый правый лист
+    size_t length;
+    size_t height; // уровней внутренних узлов над листьями
+    Inner* spare;  // запас внутренних узлов для делений (связан через parent)
+    size_t spare_count;
+
+    template <bool Const>
+    class Iterator {
+    private:
+        friend class IndexedRope;
+        template <bool> friend class Iterator;
+
+        using LeafType = typename std::conditional<Const, const Leaf, Leaf>::type;
+
+        LeafType* leaf;
+        size_t offset;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+
+        Iterator() : leaf(nullptr), offset(0) {}
+        Iterator(LeafType* l, size_t o) : leaf(l), offset(o) {}
+
+        // Неконстантный итератор приводится к константному
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst>& other) : leaf(other.leaf), offset(other.offset) {}
+
+        reference operator*() const { return leaf->items()[offset]; }
+        pointer operator->() const { return leaf->items() + offset; }
+
+        Iterator& operator++() {
+            if (++offset == leaf->count && leaf->next) { // конец листа — переходим в следующий
+                leaf = leaf->next;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        Iterator& operator--() {
+            if (offset == 0) { // начало листа — переходим в конец предыдущего
+                leaf = leaf->prev;
+                offset = leaf->count;
+            }
+            --offset;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return leaf == other.leaf && offset == other.offset; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+    Leaf* create_leaf() {
+        Leaf* leaf = new Leaf();
+        Instrumentation::on_allocate(sizeof(Leaf));
+        return leaf;
+    }
+
+    void destroy_leaf(Leaf* leaf) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < leaf->count; ++i) leaf->items()[i].~T();
+        }
+        delete leaf;
+        Instrumentation::on_deallocate(sizeof(Leaf));
+    }
+
+    // Запас внутренних узлов выделяется до изменения дерева: деление листа может поднять
+    // деления до корня, и нехватка памяти посередине оставила бы дерево несогласованным
+    void reserve_inner(size_t n) {
+        while (spare_count < n) {
+            Inner* inner = new Inner();
+            Instrumentation::on_allocate(sizeof(Inner));
+            inner->parent = spare;
+            spare = inner;
+            ++spare_count;
+        }
+    }
+
+    Inner* take_inner() {
+        assert(spare);
+        Inner* inner = spare;
+        spare = static_cast<Inner*>(inner->parent);
+        --spare_count;
+        ::new (static_cast<void*>(inner)) Inner();
+        return inner;
+    }
+
+    static void delete_inner(Inner* inner) {
+        delete inner;
+        Instrumentation::on_deallocate(sizeof(Inner));
+    }
+
+    void destroy_tree(Node* node) {
+        if (node->is_leaf) {
+            destroy_leaf(static_cast<Leaf*>(node));
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for (size_t i = 0; i < inner->count; ++i) destroy_tree(inner->children[i]);
+        delete_inner(inner);
+    }
+
+    // Позиция child среди детей parent; поиск с конца — при дописывании в конец это первый же ребенок
+    static size_t slot_of(const Inner* parent, const Node* child) {
+        size_t slot = parent->count - 1;
+        while (parent->children[slot] != child) --slot;
+        return slot;
+    }
+
+    static size_t weight(const Node* node) {
+        if (node->is_leaf) return static_cast<const Leaf*>(node)->count;
+        const Inner* inner = static_cast<const Inner*>(node);
+        size_t total = 0;
+        for (size_t i = 0; i < inner->count; ++i) total += inner->sizes[i];
+        return total;
+    }
+
+    // Изменение счетчиков на пути от node к корню (delta по модулю 2^64, может быть «отрицательной»)
+    static void adjust(Node* node, size_t delta) {
+        for (Inner* parent = node->parent; parent; node = parent, parent = parent->parent) {
+            parent->sizes[slot_of(parent, node)] += delta;
+        }
+    }
+
+    // Лист с элементом index (index < length) и позиция в нем; спуск от корня по счетчикам
+    Leaf* locate(size_t index, size_t& offset) const {
+        typename Instrumentation::Scope scope(Operation::Seek);
+        Instrumentation::on_hops(height);
+        Node* node = root;
+        while (!node->is_leaf) {
+            const Inner* inner = static_cast<const Inner*>(node);
+            size_t i = 0;
+            while (index >= inner->sizes[i]) index -= inner->sizes[i++];
+            node = inner->children[i];
+        }
+        offset = index;
+        return static_cast<Leaf*>(node);
+    }
+
+    // Подвешивание пустого (по счетчикам) узла child справа от after; полный родитель делится.
+    // Элементы child учитываются потом через adjust: child мог попасть в новый узел-сосед
+    void insert_child(Node* after, Node* child) {
+        Inner* parent = after->parent;
+        if (!parent) { // after — корень: дерево растет на уровень
+            Inner* top = take_inner();
+            top->children[0] = after;
+            top->sizes[0] = weight(after);
+            top->children[1] = child;
+            top->sizes[1] = 0;
+            top->count = 2;
+            after->parent = child->parent = top;
+            root = top;
+            ++height;
+            return;
+        }
+        size_t slot = slot_of(parent, after) + 1;
+        if (parent->count == fanout) {
+            // За последним ребенком — новый пустой сосед, как у листьев; иначе деление пополам
+            size_t keep = slot == fanout ? fanout : fanout / 2;
+            Inner* sibling = split_inner(parent, keep);
+            if (slot > keep || slot == fanout) {
+                slot -= keep;
+                parent = sibling;
+            }
+        }
+        for (size_t i = parent->count; i > slot; --i) {
+            parent->children[i] = parent->children[i - 1];
+            parent->sizes[i] = parent->sizes[i - 1];
+        }
+        parent->children[slot] = child;
+        parent->sizes[slot] = 0;
+        child->parent = parent;
+        ++parent->count;
+    }
+
+    // Новый внутренний узел справа от inner; в него переезжают дети inner с позиции keep
+    Inner* split_inner(Inner* inner, size_t keep) {
+        Inner* sibling = take_inner();
+        size_t moved = 0;
+        for (size_t i = keep; i < inner->count; ++i) {
+            sibling->children[i - keep] = inner->children[i];
+            sibling->sizes[i - keep] = inner->sizes[i];
+            inner->children[i]->parent = sibling;
+            moved += inner->sizes[i];
+        }
+        sibling->count = inner->count - keep;
+        inner->count = keep;
+        adjust(inner, static_cast<size_t>(0) - moved);
+        insert_child(inner, sibling);
+        adjust(sibling, moved);
+        return sibling;
+    }
+
+    // Новый лист справа от leaf; в него переезжают элементы leaf с позиции keep
+    Leaf* split_leaf(Leaf* leaf, size_t keep) {
+        reserve_inner(height + 1);
+        Leaf* fresh = create_leaf();
+        size_t moved = leaf->count - keep;
+        Instrumentation::on_move(moved);
+        std::uninitialized_move(leaf->items() + keep, leaf->items() + leaf->count, fresh->items());
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = keep; i < leaf->count; ++i) leaf->items()[i].~T();
+        }
+        fresh->count = moved;
+        leaf->count = keep;
+        fresh->prev = leaf;
+        fresh->next = leaf->next;
+        if (leaf->next) leaf->next->prev = fresh; else last = fresh;
+        leaf->next = fresh;
+        adjust(leaf, static_cast<size_t>(0) - moved);
+        insert_child(leaf, fresh);
+        adjust(fresh, moved);
+        return fresh;
+    }
+
+    // Удаление пустого узла из родителя; опустевший родитель удаляется следом,
+    // корень с одним ребенком заменяется этим ребенком
+    void remove_child(Inner* parent, Node* child) {
+        size_t slot = slot_of(parent, child);
+        for (size_t i = slot + 1; i < parent->count; ++i) {
+            parent->children[i - 1] = parent->children[i];
+            parent->sizes[i - 1] = parent->sizes[i];
+        }
+        --parent->count;
+        if (parent->count == 0) {
+            if (parent->parent) {
+                remove_child(parent->parent, parent);
+            } else {
+                root = nullptr;
+                height = 0;
+            }
+            delete_inner(parent);
+        } else if (parent == root && parent->count == 1) {
+            root = parent->children[0];
+            root->parent = nullptr;
+            --height;
+            delete_inner(parent);
+        } else {
+            rebalance_inner(parent);
+        }
+    }
+
+    // Малозаполненный внутренний узел сливается с соседом по родителю, если вместе они займут не больше 3/4 узла
+    void rebalance_inner(Inner* inner) {
+        Inner* parent = inner->parent;
+        if (!parent || inner->count >= fanout / 2) return;
+        size_t slot = slot_of(parent, inner);
+        const size_t limit = fanout * 3 / 4;
+        Inner* left = inner;
+        Inner* right = nullptr;
+        if (slot + 1 < parent->count && inner->count + static_cast<Inner*>(parent->children[slot + 1])->count <= limit) {
+            right = static_cast<Inner*>(parent->children[slot + 1]);
+        } else if (slot > 0 && static_cast<Inner*>(parent->children[slot - 1])->count + inner->count <= limit) {
+            left = static_cast<Inner*>(parent->children[slot - 1]);
+            right = inner;
+            --slot;
+        }
+        if (!right) return;
+        for (size_t i = 0; i < right->count; ++i) {
+            left->children[left->count + i] = right->children[i];
+            left->sizes[left->count + i] = right->sizes[i];
+            right->children[i]->parent = left;
+        }
+        left->count += right->count;
+        parent->sizes[slot] += parent->sizes[slot + 1];
+        parent->sizes[slot + 1] = 0;
+        right->count = 0;
+        remove_child(parent, right); // убирает пустой right из родителя и при необходимости поднимается выше
+        delete_inner(right);
+    }
+
+    // Удаление пустого листа
+    void remove_leaf(Leaf* leaf) {
+        if (leaf->prev) leaf->prev->next = leaf->next; else first = leaf->next;
+        if (leaf->next) leaf->next->prev = leaf->prev; else last = leaf->prev;
+        if (leaf->parent) remove_child(leaf->parent, leaf);
+        else root = nullptr;
+        destroy_leaf(leaf);
+    }
+
+    // Слияние листа second в конец first (соседи в списке листьев)
+    void merge_leaves(Leaf* first_leaf, Leaf* second) {
+        size_t moved = second->count;
+        Instrumentation::on_move(moved);
+        std::uninitialized_move(second->items(), second->items() + moved, first_leaf->items() + first_leaf->count);
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < moved; ++i) second->items()[i].~T();
+        }
+        first_leaf->count += moved;
+        second->count = 0;
+        adjust(first_leaf, moved);
+        adjust(second, static_cast<size_t>(0) - moved);
+        remove_leaf(second);
+    }
+
+    // После удаления: малозаполненный лист сливается с соседом, если вместе они займут не больше 3/4 листа
+    void rebalance_leaf(Leaf* leaf) {
+        if (leaf->count >= LeafSize / 2) return;
+        const size_t limit = LeafSize * 3 / 4;
+        if (leaf->next && leaf->count + leaf->next->count <= limit) {
+            merge_leaves(leaf, leaf->next);
+        } else if (leaf->prev && leaf->prev->count + leaf->count <= limit) {
+            merge_leaves(leaf->prev, leaf);
+        }
+    }
+
+    // Вставка в лист, где есть свободное место
+    void insert_into(Leaf* leaf, size_t offset, T&& value) {
+        T* items = leaf->items();
+        if (offset == leaf->count) {
+            ::new (static_cast<void*>(items + offset)) T(std::move(value));
+        } else {
+            Instrumentation::on_move(leaf->count - offset);
+            ::new (static_cast<void*>(items + leaf->count)) T(std::move(items[leaf->count - 1]));
+            std::move_backward(items + offset, items + leaf->count - 1, items + leaf->count);
+            items[offset] = std::move(value);
+        }
+        ++leaf->count;
+        adjust(leaf, 1);
+        ++length;
+    }
+
+    void insert_value(size_t index, T&& value) {
+        if (!root) {
+            Leaf* leaf = create_leaf();
+            root = first = last = leaf;
+            insert_into(leaf, 0, std::move(value));
+            return;
+        }
+        size_t offset;
+        Leaf* leaf;
+        if (index == length) { // вставка в конец — без спуска по дереву
+            leaf = last;
+            offset = last->count;
+        } else {
+            leaf = locate(index, offset);
+        }
+        if (leaf->count == LeafSize) {
+            if (offset == LeafSize) { // дописывание в конец полного листа — в новый пустой лист
+                leaf = split_leaf(leaf, LeafSize);
+                offset = 0;
+            } else {
+                Leaf* fresh = split_leaf(leaf, LeafSize / 2);
+                if (offset > leaf->count) {
+                    offset -= leaf->count;
+                    leaf = fresh;
+                }
+            }
+        }
+        insert_into(leaf, offset, std::move(value));
+    }
+
+    void copy_from(const IndexedRope& other) {
+        typename Instrumentation::Scope scope(Operation::Copy);
+        Instrumentation::on_copy(other.length);
+        for (const T& value : other) insert_value(length, T(value));
+    }
+
+    void release() {
+        if (root) destroy_tree(root);
+        while (spare) {
+            Inner* next = static_cast<Inner*>(spare->parent);
+            delete_inner(spare);
+            spare = next;
+        }
+        root = nullptr;
+        first = last = nullptr;
+        length = height = spare_count = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    IndexedRope() : root(nullptr), first(nullptr), last(nullptr), length(0), height(0), spare(nullptr), spare_count(0) {}
+
+    ~IndexedRope() { release(); }
+
+    IndexedRope(const IndexedRope& other) : IndexedRope() {
+        try {
+            copy_from(other);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    IndexedRope(IndexedRope&& other) noexcept : IndexedRope() { swap(other); }
+
+    IndexedRope& operator=(const IndexedRope& other) {
+        if (this == &other) return *this;
+        IndexedRope copy(other);
+        swap(copy);
+        return *this;
+    }
+
+    IndexedRope& operator=(IndexedRope&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        swap(other);
+        return *this;
+    }
+
+    void swap(IndexedRope& other) noexcept {
+        std::swap(root, other.root);
+        std::swap(first, other.first);
+        std::swap(last, other.last);
+        std::swap(length, other.length);
+        std::swap(height, other.height);
+        std::swap(spare, other.spare);
+        std::swap(spare_count, other.spare_count);
+    }
+
+    void push_back(const T& value) {
+        push_back(T(value));
+    }
+
+    void push_back(T&& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        insert_value(length, std::move(value));
+    }
+
+    void push_front(const T& value) {
+        insert(0, value);
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Insert);
+        insert_value(index, T(value)); // копия: value может лежать в листе, который разделится
+    }
+
+    void insert_middle(const T& value) {
+        insert(length / 2, value);
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        size_t offset;
+        Leaf* leaf = locate(index, offset);
+        T* items = leaf->items();
+        Instrumentation::on_move(leaf->count - offset - 1);
+        std::move(items + offset + 1, items + leaf->count, items + offset); // сдвиг только внутри листа
+        items[leaf->count - 1].~T();
+        --leaf->count;
+        --length;
+        adjust(leaf, static_cast<size_t>(0) - 1);
+        if (leaf->count == 0) {
+            remove_leaf(leaf);
+        } else {
+            rebalance_leaf(leaf);
+        }
+    }
+
+    const T& get(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        size_t offset;
+        const Leaf* leaf = locate(index, offset);
+        return leaf->items()[offset];
+    }
+
+    T& operator[](size_t index) {
+        assert(index < length);
+        size_t offset;
+        Leaf* leaf = locate(index, offset);
+        return leaf->items()[offset];
+    }
+
+    const T& operator[](size_t index) const {
+        assert(index < length);
+        size_t offset;
+        const Leaf* leaf = locate(index, offset);
+        return leaf->items()[offset];
+    }
+
+    T& at(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const { return get(index); }
+
+    T& front() {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return first->items()[0];
+    }
+
+    const T& front() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return first->items()[0];
+    }
+
+    T& back() {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return last->items()[last->count - 1];
+    }
+
+    const T& back() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return last->items()[last->count - 1];
+    }
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    // Уровней внутренних узлов над листьями (для статистики)
+    size_t depth() const { return height; }
+
+    void clear() { release(); }
+
+    iterator begin() { return iterator(first, 0); }
+    iterator end() { return last ? iterator(last, last->count) : iterator(); }
+    const_iterator begin() const { return const_iterator(first, 0); }
+    const_iterator end() const { return last ? const_iterator(last, last->count) : const_iterator(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    void print() const {
+        for (const Leaf* leaf = first; leaf != nullptr; leaf = leaf->next) {
+            for (size_t i = 0; i < leaf->count; ++i) {
+                std::cout << leaf->items()[i] << (leaf->next || i + 1 < leaf->count ? ", " : "");
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // Буферизованный вывод листьев подряд (см. OutputFormat.h)
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <initializer_list>
+#include <iostream>
+
+// Инструментирование контейнеров: последний шаблонный параметр DynamicArray, SinglyLinkedList,
+// DoublyLinkedList и UnrolledList. По умолчанию NoInstrumentation — все хуки пустые и
+// встраиваются в ничто, поэтому обычные контейнеры не платят ни байта и ни такта.
+
+// Операции, для которых собирается гистограмма задержек
+enum class Operation {
+    Append,  // push_back / emplace_back / push_front
+    Insert,  // вставка по индексу
+    Erase,   // удаление по индексу
+    Resize,  // reserve / resize / shrink_to_fit
+    Copy,    // копирование контейнера
+    Seek,    // доступ по индексу в списках
+    Apply,   // применение пакета изменений (MutationBatch)
+    Count
+};
+
+// Гистограмма задержек: корзина i считает операции длительностью [2^i, 2^(i+1)) нс
+struct LatencyHistogram {
+    static const size_t buckets = 40;
+    size_t counts[buckets] = {};
+
+    size_t total() const {
+        size_t sum = 0;
+        for (size_t count : counts) sum += count;
+        return sum;
+    }
+
+    // Верхняя граница (нс) корзины, в которую попадает доля q операций, например q = 0.99
+    double percentile(double q) const {
+        size_t n = total();
+        if (n == 0) return 0;
+        size_t seen = 0;
+        for (size_t i = 0; i < buckets; ++i) {
+            seen += counts[i];
+            if (seen >= q * n) return static_cast<double>(size_t(2) << i);
+        }
+        return static_cast<double>(size_t(2) << (buckets - 1));
+    }
+};
+
+// Снимок счетчиков на момент вызова snapshot()
+struct ContainerStats {
+    size_t allocations = 0;     // выделений памяти (узлов, чанков, буферов)
+    size_t deallocations = 0;
+    size_t bytes_allocated = 0;
+    size_t bytes_freed = 0;
+    size_t reallocations = 0;   // перевыделений буфера DynamicArray
+    size_t elements_moved = 0;  // элементов, перенесенных при росте, вставке и удалении
+    size_t elements_copied = 0; // элементов, скопированных при копировании, insert и resize
+    size_t hops = 0;            // переходов по узлам (чанкам) при поиске позиции по индексу
+    LatencyHistogram latency[static_cast<size_t>(Operation::Count)];
+
+    void print(std::ostream& out = std::cout) const {
+        static const char* names[] = {"append", "insert", "erase", "resize", "copy", "seek", "apply"};
+        out << "allocations " << allocations << ", deallocations " << deallocations
+            << ", bytes allocated " << bytes_allocated << ", bytes freed " << bytes_freed << '\n'
+            << "reallocations " << reallocations << ", elements moved " << elements_moved
+            << ", elements copied " << elements_copied << ", hops " << hops << '\n';
+        for (size_t op = 0; op < static_cast<size_t>(Operation::Count); ++op) {
+            if (latency[op].total() == 0) continue;
+            out << std::left << std::setw(8) << names[op] << std::right << latency[op].total()
+                << " ops, p50 < " << latency[op].percentile(0.5) << " ns, p99 < " << latency[op].percentile(0.99) << " ns\n";
+        }
+    }
+};
+
+// Политика по умолчанию: ничего не считает
+struct NoInstrumentation {
+    static void on_allocate(size_t) {}
+    static void on_deallocate(size_t) {}
+    static void on_reallocate() {}
+    static void on_move(size_t) {}
+    static void on_copy(size_t) {}
+    static void on_hops(size_t) {}
+
+    struct Scope { // замер длительности операции
+        explicit Scope(Operation) {}
+    };
+};
+
+// Счетчики, общие для всех контейнеров с этой политикой. Tag разделяет независимые наборы
+// (например, по подсистемам); Latency = true включает гистограмму задержек операций.
+// Счетчики атомарные (relaxed), поэтому snapshot() можно вызывать из другого потока.
+template <typename Tag = void, bool Latency = false>
+class StatsInstrumentation {
+private:
+    struct Counters {
+        std::atomic<size_t> allocations{0};
+        std::atomic<size_t> deallocations{0};
+        std::atomic<size_t> bytes_allocated{0};
+        std::atomic<size_t> bytes_freed{0};
+        std::atomic<size_t> reallocations{0};
+        std::atomic<size_t> elements_moved{0};
+        std::atomic<size_t> elements_copied{0};
+        std::atomic<size_t> hops{0};
+        std::atomic<size_t> latency[static_cast<size_t>(Operation::Count)][LatencyHistogram::buckets] = {};
+    };
+
+    static Counters& counters() {
+        static Counters instance;
+        return instance;
+    }
+
+    static void add(std::atomic<size_t>& counter, size_t value) {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+public:
+    static void on_allocate(size_t bytes) {
+        add(counters().allocations, 1);
+        add(counters().bytes_allocated, bytes);
+    }
+
+    static void on_deallocate(size_t bytes) {
+        add(counters().deallocations, 1);
+        add(counters().bytes_freed, bytes);
+    }
+
+    static void on_reallocate() { add(counters().reallocations, 1); }
+    static void on_move(size_t count) { add(counters().elements_moved, count); }
+    static void on_copy(size_t count) { add(counters().elements_copied, count); }
+    static void on_hops(size_t count) { add(counters().hops, count); }
+
+    class Scope {
+    private:
+        Operation operation;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        explicit Scope(Operation op) : operation(op) {
+            if (Latency) start = std::chrono::steady_clock::now();
+        }
+
+        ~Scope() {
+            if (!Latency) return;
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            size_t bucket = 0;
+            for (unsigned long long value = static_cast<unsigned long long>(ns); value > 1 && bucket + 1 < LatencyHistogram::buckets; value >>= 1) {
+                ++bucket;
+            }
+            add(counters().latency[static_cast<size_t>(operation)][bucket], 1);
+        }
+    };
+
+    static ContainerStats snapshot() {
+        Counters& c = counters();
+        ContainerStats stats;
+        stats.allocations = c.allocations.load(std::memory_order_relaxed);
+        stats.deallocations = c.deallocations.load(std::memory_order_relaxed);
+        stats.bytes_allocated = c.bytes_allocated.load(std::memory_order_relaxed);
+        stats.bytes_freed = c.bytes_freed.load(std::memory_order_relaxed);
+        stats.reallocations = c.reallocations.load(std::memory_order_relaxed);
+        stats.elements_moved = c.elements_moved.load(std::memory_order_relaxed);
+        stats.elements_copied = c.elements_copied.load(std::memory_order_relaxed);
+        stats.hops = c.hops.load(std::memory_order_relaxed);
+        for (size_t op = 0; op < static_cast<size_t>(Operation::Count); ++op) {
+            for (size_t i = 0; i < LatencyHistogram::buckets; ++i) {
+                stats.latency[op].counts[i] = c.latency[op][i].load(std::memory_order_relaxed);
+            }
+        }
+        return stats;
+    }
+
+    static void reset() {
+        Counters& c = counters();
+        for (auto* counter : {&c.allocations, &c.deallocations, &c.bytes_allocated, &c.bytes_freed,
+                              &c.reallocations, &c.elements_moved, &c.elements_copied, &c.hops}) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+        for (auto& histogram : c.latency) {
+            for (auto& bucket : histogram) bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Только счетчики и с гистограммой задержек
+using CountingInstrumentation = StatsInstrumentation<void, false>;
+using LatencyInstrumentation = StatsInstrumentation<void, true>;
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "ArrayView.h"
+#include "DynamicArray.h"
+#include "OutputFormat.h"
+
+// Двоичный формат DynamicArray для тривиально копируемых T: 64-байтный заголовок и сразу за ним
+// элементы в памяти как есть (порядок байт машины, поэтому файл переносим только между
+// одинаковыми платформами). Запись — один writev заголовка и данных без промежуточных буферов,
+// чтение — MappedArray<T>, представление файла через mmap: открытие не читает данные,
+// страницы подгружаются при первом обращении.
+
+struct BinaryArrayHeader {
+    static constexpr char signature[8] = {'D', 'Y', 'N', 'A', 'R', 'R', 'A', 'Y'};
+    static const uint32_t current_version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t element_size;
+    uint32_t element_align;
+    uint32_t reserved;
+    uint64_t count;
+    uint64_t checksum; // binary_checksum(данных)
+    char padding[24];  // данные начинаются со смещения 64 — выравнивание до 64 байт сохраняется
+};
+
+static_assert(sizeof(BinaryArrayHeader) == 64, "Header must be 64 bytes");
+
+// Контрольная сумма: FNV-1a по 8-байтным словам (по байтам для хвоста) — один проход без таблиц
+inline uint64_t binary_checksum(const void* data, size_t bytes) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t hash = 14695981039346656037ull;
+    const uint64_t prime = 1099511628211ull;
+    size_t words = bytes / 8;
+    for (size_t i = 0; i < words; ++i, p += 8) {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = words * 8; i < bytes; ++i, ++p) hash = (hash ^ *p) * prime;
+    return hash;
+}
+
+namespace binary_detail {
+
+[[noreturn]] inline void fail(const std::string& what, const std::string& path) {
+    throw std::system_error(errno, std::generic_category(), what + " " + path);
+}
+
+// Файловый дескриптор, закрываемый в деструкторе
+struct File {
+    int fd;
+    explicit File(int descriptor) : fd(descriptor) {}
+    File(const File&) = delete;
+    File& operator=(const File&) = delete;
+    ~File() {
+        if (fd >= 0) ::close(fd);
+    }
+};
+
+// writev, дописывающий остаток после частичной записи. Один вызов получает не больше 1 ГБ:
+// Linux сам пишет за раз не больше ~2 ГБ, а macOS и BSD при суммарной длине больше INT_MAX
+// отказывают с EINVAL, ничего не записав
+inline void write_all(int fd, iovec* parts, int count, const std::string& path) {
+    const size_t max_batch = size_t(1) << 30;
+    while (count > 0) {
+        int used = 0;
+        size_t batch = 0;
+        while (used < count && batch + parts[used].iov_len <= max_batch) batch += parts[used++].iov_len;
+        size_t clipped = 0; // полная длина части, обрезанной по границе пачки
+        if (used < count && batch < max_batch) {
+            clipped = parts[used].iov_len;
+            parts[used++].iov_len = max_batch - batch;
+        }
+        ssize_t written = ::writev(fd, parts, used);
+        if (clipped) parts[used - 1].iov_len = clipped;
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            fail("cannot write", path);
+        }
+        size_t left = static_cast<size_t>(written);
+        while (count > 0 && left >= parts->iov_len) {
+            left -= parts->iov_len;
+            ++parts;
+            --count;
+        }
+        if (count > 0) {
+            parts->iov_base = static_cast<char*>(parts->iov_base) + left;
+            parts->iov_len -= left;
+        }
+    }
+}
+
+} // namespace binary_detail
+
+// Сохранение элементов [data, data + count) в файл path (файл перезаписывается)
+template <typename T>
+void save_binary(const T* data, size_t count, const std::string& path) {
+    static_assert(std::is_trivially_copyable<T>::value, "Binary format requires trivially copyable T");
+    static_assert(alignof(T) <= 64, "Data offset keeps alignment only up to 64 bytes");
+
+    BinaryArrayHeader header = {};
+    std::memcpy(header.magic, BinaryArrayHeader::signature, sizeof(header.magic));
+    header.version = BinaryArrayHeader::current_version;
+    header.element_size = sizeof(T);
+    header.element_align = alignof(T);
+    header.count = count;
+    header.checksum = binary_checksum(data, count * sizeof(T));
+
+    binary_detail::File file(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+    if (file.fd < 0) binary_detail::fail("cannot create", path);
+    iovec parts[2] = {{&header, sizeof(header)}, {const_cast<T*>(data), count * sizeof(T)}};
+    binary_detail::write_all(file.fd, parts, count ? 2 : 1, path);
+}
+
+template <typename T, typename G, typename I>
+void save_binary(const DynamicArray<T, G, I>& array, const std::string& path) {
+    save_binary(array.data(), array.size(), path);
+}
+
+// Представление файла двоичного формата только для чтения. Интерфейс чтения как у DynamicArray
+// (operator[], at, get, front, back, итераторы, view); элементы не копируются.
+// Заголовок проверяется при открытии; контрольная сумма — только по verify() или
+// с check_checksum = true, потому что для нее нужно прочитать весь файл.
+template <typename T>
+class MappedArray {
+    static_assert(std::is_trivially_copyable<T>::value, "Binary format requires trivially copyable T");
+
+private:
+    void* mapping;  // весь файл вместе с заголовком
+    size_t mapped_bytes;
+    const T* elements;
+    size_t length;
+    uint64_t checksum;
+
+    void unmap() {
+        if (mapping) ::munmap(mapping, mapped_bytes);
+        mapping = nullptr;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using const_reference = const T&;
+    using iterator = const T*;
+    using const_iterator = const T*;
+
+    MappedArray() : mapping(nullptr), mapped_bytes(0), elements(nullptr), length(0), checksum(0) {}
+
+    explicit MappedArray(const std::string& path, bool check_checksum = false) : MappedArray() {
+        binary_detail::File file(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+        if (file.fd < 0) binary_detail::fail("cannot open", path);
+        struct stat info;
+        if (::fstat(file.fd, &info) != 0) binary_detail::fail("cannot stat", path);
+        size_t bytes = static_cast<size_t>(info.st_size);
+        if (bytes < sizeof(BinaryArrayHeader)) throw std::runtime_error("not a binary array file: " + path);
+
+        mapping = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, file.fd, 0);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            binary_detail::fail("cannot map", path);
+        }
+        mapped_bytes = bytes;
+
+        BinaryArrayHeader header;
+        std::memcpy(&header, mapping, sizeof(header));
+        const char* problem = nullptr;
+        if (std::memcmp(header.magic, BinaryArrayHeader::signature, sizeof(header.magic)) != 0) problem = "not a binary array file";
+        else if (header.version != BinaryArrayHeader::current_version) problem = "unsupported format version";
+        else if (header.element_size != sizeof(T) || header.element_align != alignof(T)) problem = "element type mismatch";
+        else if (header.count > (bytes - sizeof(header)) / sizeof(T) || header.count * sizeof(T) != bytes - sizeof(header)) problem = "truncated file";
+        if (problem) {
+            unmap();
+            throw std::runtime_error(std::string(problem) + ": " + path);
+        }
+
+        elements = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + sizeof(header));
+        length = static_cast<size_t>(header.count);
+        checksum = header.checksum;
+        if (check_checksum && !verify()) {
+            unmap();
+            throw std::runtime_error("checksum mismatch: " + path);
+        }
+    }
+
+    MappedArray(const MappedArray&) = delete;
+    MappedArray& operator=(const MappedArray&) = delete;
+
+    MappedArray(MappedArray&& other) noexcept
+        : mapping(other.mapping), mapped_bytes(other.mapped_bytes), elements(other.elements),
+          length(other.length), checksum(other.checksum) {
+        other.mapping = nullptr;
+        other.elements = nullptr;
+        other.length = 0;
+    }
+
+    MappedArray& operator=(MappedArray&& other) noexcept {
+        if (this == &other) return *this;
+        unmap();
+        mapping = std::exchange(other.mapping, nullptr);
+        mapped_bytes = other.mapped_bytes;
+        elements = std::exchange(other.elements, nullptr);
+        length = std::exchange(other.length, 0);
+        checksum = other.checksum;
+        return *this;
+    }
+
+    ~MappedArray() { unmap(); }
+
+    // Сверка данных с контрольной суммой из заголовка (читает весь файл)
+    bool verify() const { return binary_checksum(elements, length * sizeof(T)) == checksum; }
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    const T& get(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return elements[index];
+    }
+
+    const T& operator[](size_t index) const {
+        assert(index < length);
+        return elements[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return elements[index];
+    }
+
+    const T& front() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return elements[0];
+    }
+
+    const T& back() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return elements[length - 1];
+    }
+
+    const T* data() const { return elements; }
+    ArrayView<const T> view() const { return ArrayView<const T>(elements, length); }
+
+    const_iterator begin() const { return elements; }
+    const_iterator end() const { return elements + length; }
+    const_iterator cbegin() const { return elements; }
+    const_iterator cend() const { return elements + length; }
+
+    void print() const {
+        for (size_t i = 0; i < length; ++i) {
+            std::cout << elements[i] << (i < length - 1 ? ", " : "");
+        }
+        std::cout << std::endl;
+    }
+
+    // Вывод прямо из отображенных страниц, без загрузки в DynamicArray (см. OutputFormat.h)
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};
+
+// Загрузка файла в DynamicArray: одно копирование из отображенных страниц, контрольная сумма проверяется
+template <typename T>
+DynamicArray<T> load_binary(const std::string& path) {
+    MappedArray<T> mapped(path, true);
+    DynamicArray<T> array(mapped.size());
+    array.insert(0, mapped.begin(), mapped.end());
+    return array;
+}
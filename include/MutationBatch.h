@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "DynamicArray.h"
+
+// Журнал изменений по индексам для пакетного применения: DynamicArray, SinglyLinkedList
+// и DoublyLinkedList::apply(std::move(batch)). Операции insert/erase/insert_middle
+// записываются с индексами относительно состояния после предыдущих операций — так же,
+// как при вызовах по одной, — и проверяются сразу, с теми же исключениями.
+// Итоговая последовательность хранится как цепочка отрезков: «исходные элементы
+// [start, start + count)» или «вставленное значение». Отрезки лежат в декартовом дереве
+// с неявным ключом (позицией), поэтому запись операции стоит O(log k), а apply проходит
+// контейнер один раз: O(n + k) поверх O(k log k) на запись k операций.
+template <typename T>
+class MutationBatch {
+private:
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    struct Segment {
+        size_t start;  // первый исходный элемент или индекс значения в values
+        size_t count;  // длина отрезка (у вставки — 1)
+        size_t total;  // сумма длин в поддереве
+        uint32_t left;
+        uint32_t right;
+        uint32_t priority;
+        bool inserted;
+    };
+
+    DynamicArray<Segment> segments; // узлы дерева; вырезанные при erase остаются до clear()
+    DynamicArray<T> values;         // вставленные значения в порядке записи
+    uint32_t root;
+    size_t base;   // длина контейнера, для которой записан журнал
+    size_t length; // длина после всех записанных операций
+    size_t recorded;
+    uint32_t seed;
+
+    size_t total(uint32_t node) const { return node == npos ? 0 : segments[node].total; }
+
+    void update(uint32_t node) {
+        Segment& s = segments[node];
+        s.total = total(s.left) + s.count + total(s.right);
+    }
+
+    uint32_t new_segment(size_t start, size_t count, bool inserted) {
+        if (segments.size() >= npos) throw std::length_error("MutationBatch is full");
+        seed ^= seed << 13; // xorshift32: приоритеты узлов
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        segments.push_back(Segment{start, count, count, npos, npos, seed, inserted});
+        return static_cast<uint32_t>(segments.size() - 1);
+    }
+
+    // Разрезание дерева на первые k элементов и остальные; отрезок,
+    // через который проходит разрез, делится на два узла
+    std::pair<uint32_t, uint32_t> split(uint32_t node, size_t k) {
+        if (node == npos) return {npos, npos};
+        size_t left_total = total(segments[node].left);
+        if (k <= left_total) {
+            std::pair<uint32_t, uint32_t> parts = split(segments[node].left, k);
+            segments[node].left = parts.second;
+            update(node);
+            return {parts.first, node};
+        }
+        size_t cut = k - left_total;
+        if (cut >= segments[node].count) {
+            std::pair<uint32_t, uint32_t> parts = split(segments[node].right, cut - segments[node].count);
+            segments[node].right = parts.first;
+            update(node);
+            return {node, parts.second};
+        }
+        // Разрез внутри отрезка исходных элементов
+        uint32_t tail = new_segment(segments[node].start + cut, segments[node].count - cut, false);
+        segments[node].count = cut;
+        uint32_t right = merge(tail, segments[node].right);
+        segments[node].right = npos;
+        update(node);
+        return {node, right};
+    }
+
+    uint32_t merge(uint32_t a, uint32_t b) {
+        if (a == npos) return b;
+        if (b == npos) return a;
+        if (segments[a].priority > segments[b].priority) {
+            segments[a].right = merge(segments[a].right, b);
+            update(a);
+            return a;
+        }
+        segments[b].left = merge(a, segments[b].left);
+        update(b);
+        return b;
+    }
+
+    template <typename U>
+    void insert_value(size_t index, U&& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        values.push_back(std::forward<U>(value));
+        uint32_t node = new_segment(values.size() - 1, 1, true);
+        std::pair<uint32_t, uint32_t> parts = split(root, index);
+        root = merge(merge(parts.first, node), parts.second);
+        ++length;
+        ++recorded;
+    }
+
+public:
+    explicit MutationBatch(size_t base_size = 0) : values(0), root(npos), base(0), length(0), recorded(0), seed(2463534242u) {
+        clear(base_size);
+    }
+
+    void insert(size_t index, const T& value) { insert_value(index, value); }
+    void insert(size_t index, T&& value) { insert_value(index, std::move(value)); }
+
+    void insert_middle(const T& value) { insert_value(length / 2, value); }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        std::pair<uint32_t, uint32_t> left = split(root, index);
+        std::pair<uint32_t, uint32_t> right = split(left.second, 1);
+        root = merge(left.first, right.second); // вырезанный элемент просто не попадает в дерево
+        --length;
+        ++recorded;
+    }
+
+    // Новый пустой журнал для контейнера длины base_size
+    void clear(size_t base_size) {
+        segments.clear();
+        values.clear();
+        base = length = base_size;
+        recorded = 0;
+        root = base_size > 0 ? new_segment(0, base_size, false) : npos;
+    }
+
+    size_t base_size() const { return base; }
+    size_t size() const { return length; }         // длина контейнера после apply
+    size_t operations() const { return recorded; } // записано операций
+    bool empty() const { return recorded == 0; }
+
+    // Обход итоговой последовательности слева направо: keep(start, count) для отрезка
+    // исходных элементов (start растет от вызова к вызову), insert(value) для вставки
+    template <typename Keep, typename Insert>
+    void for_each_segment(Keep keep, Insert insert) {
+        DynamicArray<uint32_t> path(0);
+        uint32_t node = root;
+        while (node != npos || !path.empty()) {
+            for (; node != npos; node = segments[node].left) path.push_back(node);
+            node = path[path.size() - 1];
+            path.erase(path.size() - 1);
+            const Segment& s = segments[node];
+            if (s.inserted) insert(values[s.start]);
+            else keep(s.start, s.count);
+            node = s.right;
+        }
+    }
+};
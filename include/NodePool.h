@@ -0,0 +1,210 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// Статистика пула узлов
+struct PoolStats {
+    size_t chunks = 0;         // сколько крупных блоков (чанков) запрошено у системы
+    size_t bytes_reserved = 0; // суммарный размер чанков в байтах
+    size_t allocations = 0;    // сколько узлов выдано
+    size_t reused = 0;         // сколько из них взято из списка освобожденных
+    size_t deallocations = 0;  // сколько узлов возвращено в пул
+};
+
+// Пул блоков одинакового размера. Блоки нарезаются из непрерывных чанков,
+// освобожденные блоки попадают в список свободных и выдаются повторно.
+// Вся память возвращается системе в деструкторе за O(числа чанков).
+class NodePool {
+private:
+    struct FreeBlock { // освобожденный блок хранит указатель на следующий свободный
+        FreeBlock* next;
+    };
+
+    struct Chunk { // заголовок чанка; блоки идут сразу за ним
+        Chunk* next;
+        size_t bytes;
+    };
+
+    static const size_t min_chunk_blocks = 32;   // блоков в первом чанке
+    static const size_t max_chunk_blocks = 4096; // предел роста чанка
+
+    size_t object_size;  // размер объекта, под который настроен пул (0 — еще не настроен)
+    size_t object_align; // выравнивание объекта
+    size_t block_size;   // шаг нарезки блоков
+    size_t chunk_align;  // выравнивание, с которым выделяются чанки
+    FreeBlock* free_list;
+    Chunk* chunks;
+    char* cursor;    // следующий нетронутый блок в текущем чанке
+    char* chunk_end; // конец текущего чанка
+    size_t next_chunk_blocks;
+    PoolStats statistics;
+
+    static size_t round_up(size_t value, size_t align) {
+        return (value + align - 1) / align * align;
+    }
+
+    size_t header_size() const {
+        return round_up(sizeof(Chunk), object_align);
+    }
+
+    void add_chunk() {
+        size_t bytes = header_size() + next_chunk_blocks * block_size;
+        Chunk* chunk = static_cast<Chunk*>(::operator new(bytes, std::align_val_t(chunk_align)));
+        chunk->next = chunks;
+        chunk->bytes = bytes;
+        chunks = chunk;
+        cursor = reinterpret_cast<char*>(chunk) + header_size();
+        chunk_end = reinterpret_cast<char*>(chunk) + bytes;
+
+        ++statistics.chunks;
+        statistics.bytes_reserved += bytes;
+        if (next_chunk_blocks < max_chunk_blocks) next_chunk_blocks *= 2; // следующие чанки крупнее
+    }
+
+public:
+    NodePool()
+        : object_size(0), object_align(0), block_size(0), chunk_align(0),
+          free_list(nullptr), chunks(nullptr), cursor(nullptr), chunk_end(nullptr),
+          next_chunk_blocks(min_chunk_blocks) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        release();
+    }
+
+    // Может ли пул выдавать объекты такого размера и выравнивания.
+    // Первый запрос настраивает пул под свой тип.
+    bool accepts(size_t size, size_t align) {
+        if (object_size == 0) {
+            object_size = size;
+            object_align = align < alignof(FreeBlock) ? alignof(FreeBlock) : align;
+            block_size = round_up(size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size, object_align);
+            chunk_align = object_align < alignof(Chunk) ? alignof(Chunk) : object_align;
+        }
+        return owns(size, align);
+    }
+
+    // Выдан ли объект такого типа пулом (а не запасным аллокатором)
+    bool owns(size_t size, size_t align) const {
+        return size == object_size && (align <= object_align);
+    }
+
+    void* allocate() {
+        ++statistics.allocations;
+        if (free_list) { // сначала переиспользуем освобожденные узлы
+            FreeBlock* block = free_list;
+            free_list = block->next;
+            ++statistics.reused;
+            return block;
+        }
+        if (cursor == chunk_end) {
+            add_chunk();
+        }
+        void* block = cursor;
+        cursor += block_size;
+        return block;
+    }
+
+    void deallocate(void* p) {
+        FreeBlock* block = static_cast<FreeBlock*>(p);
+        block->next = free_list;
+        free_list = block;
+        ++statistics.deallocations;
+    }
+
+    // Возврат всех чанков системе; ранее выданные блоки становятся недействительными
+    void release() {
+        while (chunks) {
+            Chunk* next = chunks->next;
+            ::operator delete(chunks, std::align_val_t(chunk_align));
+            chunks = next;
+        }
+        free_list = nullptr;
+        cursor = chunk_end = nullptr;
+        next_chunk_blocks = min_chunk_blocks;
+    }
+
+    const PoolStats& stats() const {
+        return statistics;
+    }
+};
+
+// Аллокатор, совместимый с std::allocator, выдающий одиночные объекты из NodePool.
+// Копии аллокатора разделяют один пул; запросы другого размера и массивы
+// (n != 1) обслуживает std::allocator.
+template <typename T>
+class PoolAllocator {
+private:
+    template <typename U> friend class PoolAllocator;
+
+    std::shared_ptr<NodePool> pool;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    PoolAllocator() : pool(std::make_shared<NodePool>()) {}
+
+    // Перемещение тоже копирует: перемещенный контейнер должен оставаться пригодным к работе
+    PoolAllocator(const PoolAllocator& other) noexcept : pool(other.pool) {}
+    PoolAllocator& operator=(const PoolAllocator& other) noexcept {
+        pool = other.pool;
+        return *this;
+    }
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+    T* allocate(size_t n) {
+        if (n == 1 && pool->accepts(sizeof(T), alignof(T))) {
+            return static_cast<T*>(pool->allocate());
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        if (n == 1 && pool->owns(sizeof(T), alignof(T))) {
+            pool->deallocate(p);
+        } else {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    // Копия контейнера получает собственный пул
+    PoolAllocator select_on_container_copy_construction() const {
+        return PoolAllocator();
+    }
+
+    // Пул принадлежит только этому аллокатору: при его разрушении освободится вся память
+    bool exclusive() const {
+        return pool.use_count() == 1;
+    }
+
+    const PoolStats& stats() const {
+        return pool->stats();
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept {
+        return pool == other.pool;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept {
+        return pool != other.pool;
+    }
+};
+
+template <typename Alloc>
+struct is_pool_allocator : std::false_type {};
+
+template <typename T>
+struct is_pool_allocator<PoolAllocator<T>> : std::true_type {};
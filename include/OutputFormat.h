@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <unistd.h>
+
+// Буферизованный вывод контейнеров (метод write_to). Элементы форматируются в буфер
+// BufferedWriter (64 КБ), который сбрасывается в приемник целыми блоками: в файловый
+// дескриптор через write(2) или в std::ostream через write(). Числа форматируются
+// std::to_chars (для double — кратчайшая запись, которая читается обратно без потерь),
+// сброс std::ostream после каждого элемента, как у print() с std::endl, не делается.
+
+// Оформление вывода: разделитель между элементами, текст до и после, экранирование строк
+struct OutputFormat {
+    enum class Quoting { None, CSV, JSON };
+
+    std::string_view prefix;
+    std::string_view separator = " ";
+    std::string_view suffix = "\n";
+    Quoting quoting = Quoting::None;
+
+    // Элементы через separator в одну строку
+    static OutputFormat plain(std::string_view separator = " ") { return {"", separator, "\n", Quoting::None}; }
+    // По элементу на строку
+    static OutputFormat lines() { return {"", "\n", "\n", Quoting::None}; }
+    // Одна строка CSV; строки с запятыми, кавычками и переводами строк берутся в кавычки
+    static OutputFormat csv() { return {"", ",", "\n", Quoting::CSV}; }
+    // Массив JSON; строки в кавычках с экранированием, NaN и бесконечности — null
+    static OutputFormat json() { return {"[", ", ", "]\n", Quoting::JSON}; }
+};
+
+// Приемник — файловый дескриптор; частичные записи дописываются
+class FileDescriptorSink {
+private:
+    int fd;
+
+public:
+    explicit FileDescriptorSink(int descriptor) : fd(descriptor) {}
+
+    void write(const char* data, size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::system_error(errno, std::generic_category(), "write failed");
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+};
+
+// Приемник — поток; ошибки сообщаются состоянием потока, как при обычном operator<<
+class StreamSink {
+private:
+    std::ostream& out;
+
+public:
+    explicit StreamSink(std::ostream& stream) : out(stream) {}
+
+    void write(const char* data, size_t size) { out.write(data, static_cast<std::streamsize>(size)); }
+};
+
+// Буфер форматирования поверх приемника. Один писатель можно передать в write_to
+// нескольких контейнеров подряд: буфер выделяется один раз и сбрасывается только при заполнении,
+// по flush() и в деструкторе
+template <typename Sink>
+class BufferedWriter {
+private:
+    static const size_t buffer_size = 64 * 1024;
+    static const size_t max_number = 64; // с запасом для любого числа из to_chars
+
+    Sink sink;
+    std::unique_ptr<char[]> buffer;
+    size_t used;
+
+    void reserve(size_t n) {
+        if (used + n > buffer_size) flush();
+    }
+
+    void append_quoted(std::string_view text, OutputFormat::Quoting quoting) {
+        if (quoting == OutputFormat::Quoting::CSV) {
+            if (text.find_first_of(",\"\r\n") == std::string_view::npos) {
+                append(text);
+                return;
+            }
+            append('"');
+            for (char c : text) {
+                if (c == '"') append('"');
+                append(c);
+            }
+            append('"');
+            return;
+        }
+        append('"');
+        for (char c : text) {
+            unsigned char u = static_cast<unsigned char>(c);
+            if (c == '"' || c == '\\') {
+                append('\\');
+                append(c);
+            } else if (u < 0x20) {
+                static const char hex[] = "0123456789abcdef";
+                const char escape[] = {'\\', 'u', '0', '0', hex[u >> 4], hex[u & 15]};
+                append(std::string_view(escape, sizeof(escape)));
+            } else {
+                append(c);
+            }
+        }
+        append('"');
+    }
+
+    template <typename T>
+    void append_number(T value) {
+        reserve(max_number);
+        auto result = std::to_chars(buffer.get() + used, buffer.get() + buffer_size, value);
+        used = static_cast<size_t>(result.ptr - buffer.get());
+    }
+
+public:
+    explicit BufferedWriter(Sink output) : sink(std::move(output)), buffer(new char[buffer_size]), used(0) {}
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    // Исключение из сброса в деструкторе не выпускается; чтобы узнать об ошибке, вызовите flush()
+    ~BufferedWriter() {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+
+    void flush() {
+        if (used == 0) return;
+        size_t size = used;
+        used = 0;
+        sink.write(buffer.get(), size);
+    }
+
+    void append(char c) {
+        reserve(1);
+        buffer[used++] = c;
+    }
+
+    void append(std::string_view text) {
+        if (text.size() > buffer_size) { // длинный текст — напрямую, минуя буфер
+            flush();
+            sink.write(text.data(), text.size());
+            return;
+        }
+        reserve(text.size());
+        std::memcpy(buffer.get() + used, text.data(), text.size());
+        used += text.size();
+    }
+
+    // Один элемент: числа — to_chars, строки — с экранированием по quoting, остальное — operator<<
+    template <typename T>
+    void append_value(const T& value, OutputFormat::Quoting quoting = OutputFormat::Quoting::None) {
+        if constexpr (std::is_same<T, bool>::value) {
+            append(value ? std::string_view("true") : std::string_view("false"));
+        } else if constexpr (std::is_same<T, char>::value) {
+            if (quoting == OutputFormat::Quoting::None) append(value);
+            else append_quoted(std::string_view(&value, 1), quoting);
+        } else if constexpr (std::is_integral<T>::value) {
+            append_number(value);
+        } else if constexpr (std::is_floating_point<T>::value) {
+            if (quoting == OutputFormat::Quoting::JSON && !std::isfinite(value)) append(std::string_view("null"));
+            else append_number(value);
+        } else if constexpr (std::is_convertible<const T&, std::string_view>::value) {
+            std::string_view text = value;
+            if (quoting == OutputFormat::Quoting::None) append(text);
+            else append_quoted(text, quoting);
+        } else {
+            std::ostringstream formatted; // запасной путь для типов без быстрого форматирования
+            formatted << value;
+            std::string text = formatted.str();
+            if (quoting == OutputFormat::Quoting::None) append(text);
+            else append_quoted(text, quoting);
+        }
+    }
+};
+
+// Вывод [first, last) в writer в формате format
+template <typename InputIt, typename Sink>
+void write_range(InputIt first, InputIt last, BufferedWriter<Sink>& writer, const OutputFormat& format) {
+    writer.append(format.prefix);
+    if (first != last) {
+        writer.append_value(*first, format.quoting);
+        for (++first; first != last; ++first) {
+            writer.append(format.separator);
+            writer.append_value(*first, format.quoting);
+        }
+    }
+    writer.append(format.suffix);
+}
+
+template <typename InputIt>
+void write_range(InputIt first, InputIt last, std::ostream& out, const OutputFormat& format) {
+    BufferedWriter<StreamSink> writer{StreamSink(out)};
+    write_range(first, last, writer, format);
+    writer.flush();
+}
+
+template <typename InputIt>
+void write_range(InputIt first, InputIt last, int fd, const OutputFormat& format) {
+    BufferedWriter<FileDescriptorSink> writer{FileDescriptorSink(fd)};
+    write_range(first, last, writer, format);
+    writer.flush(); // ошибки записи — исключением, а не молча в деструкторе
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "DynamicArray.h"
+#include "ThreadPool.h"
+
+// Параллельные алгоритмы над DynamicArray поверх ThreadPool (по умолчанию — ThreadPool::global()).
+// Диапазон рекурсивно делится пополам до кусков не длиннее grain, куски короче
+// обрабатываются последовательно, поэтому маленькие массивы не платят за потоки.
+
+static const size_t default_parallel_grain = 16384;
+
+// Вызывает f(element) для каждого элемента
+template <typename T, typename G, typename I, typename F>
+void parallel_for_each(DynamicArray<T, G, I>& array, F f, size_t grain = default_parallel_grain,
+                       ThreadPool& pool = ThreadPool::global()) {
+    T* data = array.data();
+    pool.parallel_for(0, array.size(), grain, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) f(data[i]);
+    });
+}
+
+// Свертка операцией op (ассоциативной) с начальным значением init.
+// init должен быть нейтральным элементом op: он входит в каждую частичную свертку
+template <typename T, typename G, typename I, typename R, typename Op = std::plus<R>>
+R parallel_reduce(const DynamicArray<T, G, I>& array, R init, Op op = Op(), size_t grain = default_parallel_grain,
+                  ThreadPool& pool = ThreadPool::global()) {
+    struct Reducer {
+        const T* data;
+        const R& init;
+        Op& op;
+        size_t grain;
+        ThreadPool& pool;
+
+        R operator()(size_t first, size_t last) const {
+            if (last - first <= grain || pool.size() == 1) {
+                R result = init;
+                for (size_t i = first; i < last; ++i) result = op(result, data[i]);
+                return result;
+            }
+            size_t middle = first + (last - first) / 2;
+            R left = init, right = init;
+            pool.invoke([&] { left = (*this)(first, middle); }, [&] { right = (*this)(middle, last); });
+            return op(left, right);
+        }
+    };
+    if (grain == 0) grain = 1;
+    return Reducer{array.data(), init, op, grain, pool}(0, array.size());
+}
+
+namespace parallel_detail {
+
+// Слияние отсортированных [a, a + na) и [b, b + nb) в out перемещением;
+// большие слияния делятся по медиане большей части и бинарному поиску в меньшей
+template <typename T, typename Compare>
+void merge(T* a, size_t na, T* b, size_t nb, T* out, Compare& less, size_t grain, ThreadPool& pool) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    size_t ma = na / 2;
+    size_t mb = ma < na && na + nb > std::max<size_t>(grain, 2)
+                    ? static_cast<size_t>(std::lower_bound(b, b + nb, a[ma], less) - b)
+                    : 0;
+    // Мелкое слияние или разрез, оставляющий одну из частей пустой (na = 1, mb = 0):
+    // рекурсия с теми же аргументами не закончилась бы
+    if (na + nb <= std::max<size_t>(grain, 2) || ma + mb == 0) {
+        std::merge(std::make_move_iterator(a), std::make_move_iterator(a + na),
+                   std::make_move_iterator(b), std::make_move_iterator(b + nb), out, less);
+        return;
+    }
+    pool.invoke([&] { merge(a, ma, b, mb, out, less, grain, pool); },
+                [&] { merge(a + ma, na - ma, b + mb, nb - mb, out + ma + mb, less, grain, pool); });
+}
+
+// Сортировка слиянием с буфером: половины сортируются параллельно в противоположный
+// массив и сливаются обратно; куски не длиннее grain сортирует std::sort
+template <typename T, typename Compare>
+void sort(T* data, T* buffer, size_t n, bool result_in_buffer, Compare& less, size_t grain, ThreadPool& pool) {
+    if (n <= grain) {
+        std::sort(data, data + n, less);
+        if (result_in_buffer) std::move(data, data + n, buffer);
+        return;
+    }
+    size_t middle = n / 2;
+    pool.invoke([&] { sort(data, buffer, middle, !result_in_buffer, less, grain, pool); },
+                [&] { sort(data + middle, buffer + middle, n - middle, !result_in_buffer, less, grain, pool); });
+    T* from = result_in_buffer ? data : buffer;
+    T* to = result_in_buffer ? buffer : data;
+    merge(from, middle, from + middle, n - middle, to, less, grain, pool);
+}
+
+} // namespace parallel_detail
+
+// Сортировка (нестабильная); требует O(n) дополнительной памяти
+template <typename T, typename G, typename I, typename Compare = std::less<T>>
+void parallel_sort(DynamicArray<T, G, I>& array, Compare less = Compare(), size_t grain = default_parallel_grain,
+                   ThreadPool& pool = ThreadPool::global()) {
+    size_t n = array.size();
+    if (grain < 2) grain = 2; // кусок из одного элемента нечего делить при слиянии
+    if (n <= grain || pool.size() == 1) {
+        std::sort(array.begin(), array.end(), less);
+        return;
+    }
+    std::vector<T> buffer(std::make_move_iterator(array.begin()), std::make_move_iterator(array.end()));
+    parallel_detail::sort(buffer.data(), array.data(), n, true, less, grain, pool);
+}
+
+// Включающая префиксная сумма на месте: array[i] = op(array[0], ..., array[i]).
+// Два прохода по блокам: свертки блоков, затем сканирование каждого блока со своим смещением
+template <typename T, typename G, typename I, typename Op = std::plus<T>>
+void parallel_scan(DynamicArray<T, G, I>& array, Op op = Op(), size_t grain = default_parallel_grain,
+                   ThreadPool& pool = ThreadPool::global()) {
+    size_t n = array.size();
+    if (n == 0) return;
+    T* data = array.data();
+    if (grain == 0) grain = 1;
+    size_t blocks = std::min((n + grain - 1) / grain, pool.size() * 4);
+    if (blocks <= 1 || pool.size() == 1) {
+        for (size_t i = 1; i < n; ++i) data[i] = op(data[i - 1], data[i]);
+        return;
+    }
+    size_t block = (n + blocks - 1) / blocks;
+    blocks = (n + block - 1) / block;
+
+    // Проход 1: префиксная сумма внутри каждого блока
+    pool.parallel_for(0, blocks, 1, [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            size_t end = std::min(n, (b + 1) * block);
+            for (size_t i = b * block + 1; i < end; ++i) data[i] = op(data[i - 1], data[i]);
+        }
+    });
+    // Смещения блоков — последовательно, их мало
+    std::vector<T> offsets;
+    offsets.reserve(blocks);
+    offsets.push_back(data[block - 1]);
+    for (size_t b = 1; b + 1 < blocks; ++b) offsets.push_back(op(offsets.back(), data[(b + 1) * block - 1]));
+    // Проход 2: добавление смещения предыдущих блоков
+    pool.parallel_for(1, blocks, 1, [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            const T& offset = offsets[b - 1];
+            size_t end = std::min(n, (b + 1) * block);
+            for (size_t i = b * block; i < end; ++i) data[i] = op(offset, data[i]);
+        }
+    });
+}
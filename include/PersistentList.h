@@ -0,0 +1,336 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+// Односвязный список со структурным разделением (persistent list): узлы со счетчиком ссылок
+// общие у списка и его снимков. Копия стоит O(1). Изменение на позиции index копирует только
+// разделяемые узлы на пути от головы до index (path copying), хвост за index остается общим.
+// Пока снимков нет, узлы принадлежат одному списку и меняются на месте, как в SinglyLinkedList:
+// push_front, pop_front и push_back — O(1), insert/erase/set — O(index).
+// Первый push_back после снимка копирует весь список (общий хвост менять нельзя).
+// Счетчики атомарные: снимки можно читать из других потоков, пока исходный список меняется.
+// Двусвязного аналога нет: обратные указатели привязывают каждый узел к соседу слева,
+// поэтому хвост нельзя разделить между версиями — любая правка копировала бы весь список.
+// Если нужны снимки данных, которые хранятся в DoublyLinkedList, их заменяет этот список
+// (те же операции по индексу) или CowArray.
+template <typename T, typename Instrumentation = NoInstrumentation>
+class PersistentList {
+private:
+    struct Node {
+        std::atomic<size_t> refs;
+        Node* next; // владеющая ссылка
+        T data;
+
+        template <typename... Args>
+        Node(Node* following, Args&&... args) : refs(1), next(following), data(std::forward<Args>(args)...) {}
+    };
+
+    Node* head;
+    Node* tail;
+    size_t length;
+    // Первые owned узлов точно принадлежат только этому списку — если с тех пор
+    // со списка не снимали копий (snapshots == seen)
+    size_t owned;
+    size_t seen;
+    mutable std::atomic<size_t> snapshots; // сколько раз список копировали
+
+    static bool unique(const Node* node) {
+        return node->refs.load(std::memory_order_acquire) == 1;
+    }
+
+    static Node* retain(Node* node) {
+        if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    // Отпускает цепочку без рекурсии: узел удаляется, если это была последняя ссылка,
+    // и тогда отпускается его next
+    static void release(Node* node) {
+        while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Node* next = node->next;
+            delete node;
+            Instrumentation::on_deallocate(sizeof(Node));
+            node = next;
+        }
+    }
+
+    template <typename... Args>
+    static Node* create_node(Node* next, Args&&... args) {
+        Node* node = new Node(next, std::forward<Args>(args)...);
+        Instrumentation::on_allocate(sizeof(Node));
+        return node;
+    }
+
+    size_t exclusive() const {
+        return seen == snapshots.load(std::memory_order_relaxed) ? owned : 0;
+    }
+
+    void set_exclusive(size_t count) {
+        owned = count;
+        seen = snapshots.load(std::memory_order_relaxed);
+    }
+
+    Node*& link_after(Node* prev) { return prev ? prev->next : head; }
+
+    // Узел после prev (или голова), принадлежащий только этому списку: разделяемый заменяется копией
+    Node* own_next(Node* prev) {
+        Node*& link = link_after(prev);
+        Node* node = link;
+        if (unique(node)) return node;
+        Node* copy = create_node(node->next, node->data);
+        retain(node->next);
+        Instrumentation::on_copy(1);
+        release(node);
+        if (node == tail) tail = copy;
+        link = copy;
+        return copy;
+    }
+
+    // Узел перед позицией index (nullptr для index = 0); все узлы до index становятся собственными
+    Node* own_prefix(size_t index) {
+        typename Instrumentation::Scope scope(Operation::Seek);
+        Instrumentation::on_hops(index);
+        size_t known = exclusive();
+        Node* prev = nullptr;
+        for (size_t i = 0; i < index; ++i) {
+            prev = i < known ? link_after(prev) : own_next(prev);
+        }
+        if (index > known) set_exclusive(index);
+        return prev;
+    }
+
+    void reset() {
+        head = tail = nullptr;
+        length = 0;
+        set_exclusive(0);
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using const_reference = const T&;
+
+    // Итератор только для чтения: изменения идут через set(), insert() и erase()
+    class const_iterator {
+    private:
+        const Node* current;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        explicit const_iterator(const Node* node = nullptr) : current(node) {}
+
+        reference operator*() const { return current->data; }
+        pointer operator->() const { return &current->data; }
+
+        const_iterator& operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            current = current->next;
+            return old;
+        }
+
+        bool operator==(const const_iterator& other) const { return current == other.current; }
+        bool operator!=(const const_iterator& other) const { return current != other.current; }
+    };
+    using iterator = const_iterator;
+
+    PersistentList() : snapshots(0) { reset(); }
+
+    ~PersistentList() { release(head); }
+
+    // Снимок за O(1)
+    PersistentList(const PersistentList& other) : snapshots(0) {
+        reset();
+        other.snapshots.fetch_add(1, std::memory_order_relaxed);
+        head = retain(other.head);
+        tail = other.tail;
+        length = other.length;
+    }
+
+    PersistentList(PersistentList&& other) noexcept : snapshots(0) {
+        head = std::exchange(other.head, nullptr);
+        tail = std::exchange(other.tail, nullptr);
+        length = std::exchange(other.length, 0);
+        set_exclusive(other.exclusive());
+        other.set_exclusive(0);
+    }
+
+    PersistentList& operator=(const PersistentList& other) {
+        other.snapshots.fetch_add(1, std::memory_order_relaxed);
+        Node* node = retain(other.head);
+        release(head);
+        head = node;
+        tail = other.tail;
+        length = other.length;
+        set_exclusive(0);
+        return *this;
+    }
+
+    PersistentList& operator=(PersistentList&& other) noexcept {
+        if (this == &other) return *this;
+        release(head);
+        head = std::exchange(other.head, nullptr);
+        tail = std::exchange(other.tail, nullptr);
+        length = std::exchange(other.length, 0);
+        set_exclusive(other.exclusive());
+        other.set_exclusive(0);
+        return *this;
+    }
+
+    // Явный снимок — то же, что копия
+    PersistentList snapshot() const { return *this; }
+
+    void push_front(const T& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        size_t known = exclusive();
+        head = create_node(head, value); // новый узел забирает ссылку на старую голову
+        if (!tail) tail = head;
+        ++length;
+        set_exclusive(known + 1);
+    }
+
+    void push_front(T&& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        size_t known = exclusive();
+        head = create_node(head, std::move(value));
+        if (!tail) tail = head;
+        ++length;
+        set_exclusive(known + 1);
+    }
+
+    void pop_front() {
+        if (!head) throw std::out_of_range("List is empty");
+        size_t known = exclusive();
+        Node* node = head;
+        head = retain(node->next);
+        release(node);
+        if (!head) tail = nullptr;
+        --length;
+        set_exclusive(known ? known - 1 : 0);
+    }
+
+    // O(1), пока весь список собственный. Первый push_back после снимка — O(n): хвост общий
+    // со снимком, поэтому сначала копируются все разделяемые узлы; следующие снова O(1)
+    void push_back(const T& value) {
+        if (length == 0 || exclusive() < length) {
+            insert(length, value);
+            return;
+        }
+        typename Instrumentation::Scope scope(Operation::Append);
+        tail->next = create_node(nullptr, value);
+        tail = tail->next;
+        ++length;
+        set_exclusive(length);
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Insert);
+        T copy(value); // value может лежать в узле, который скопирует own_prefix
+        Node* prev = own_prefix(index);
+        size_t known = exclusive();
+        Node*& link = link_after(prev);
+        link = create_node(link, std::move(copy));
+        if (index == length) tail = link;
+        ++length;
+        set_exclusive(known > index ? known + 1 : index + 1);
+    }
+
+    void insert_middle(const T& value) {
+        insert(length / 2, value);
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        Node* prev = own_prefix(index);
+        size_t known = exclusive();
+        Node*& link = link_after(prev);
+        Node* node = link;
+        link = retain(node->next);
+        release(node);
+        if (index == length - 1) tail = prev;
+        --length;
+        set_exclusive(known > index ? known - 1 : index);
+    }
+
+    // Замена значения: копируется путь до index и сам узел, если он разделяется
+    void set(size_t index, const T& value) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        T copy(value);
+        Node* prev = own_prefix(index);
+        size_t known = exclusive();
+        Node* node = known > index ? link_after(prev) : own_next(prev);
+        node->data = std::move(copy);
+        if (known <= index) set_exclusive(index + 1);
+    }
+
+    const T& front() const {
+        if (!head) throw std::out_of_range("List is empty");
+        return head->data;
+    }
+
+    const T& back() const {
+        if (!tail) throw std::out_of_range("List is empty");
+        return tail->data;
+    }
+
+    const T& get(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        const Node* node = head;
+        for (size_t i = 0; i < index; ++i) node = node->next;
+        return node->data;
+    }
+
+    void clear() {
+        release(head);
+        reset();
+    }
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    // Узлов от головы, принадлежащих только этому списку (дальше начинается общий со снимками хвост)
+    size_t exclusive_prefix() const {
+        size_t count = 0;
+        for (const Node* node = head; node && unique(node); node = node->next) ++count;
+        return count;
+    }
+
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    void print() const {
+        for (const Node* node = head; node; node = node->next) {
+            std::cout << node->data << (node->next ? ", " : "");
+        }
+        std::cout << std::endl;
+    }
+
+    // Буферизованный вывод (см. OutputFormat.h)
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};
@@ -0,0 +1,427 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Instrumentation.h"
+#include "MutationBatch.h"
+#include "NodePool.h"
+#include "OutputFormat.h"
+
+template <typename T>
+class Node {
+public:
+    T data;
+    Node* next;
+
+    Node(const T& value) : data(value), next(nullptr) {}
+    Node(T&& value) : data(std::move(value)), next(nullptr) {}
+};
+
+// Прямой (forward) итератор односвязного списка; Const = true — итератор только для чтения
+template <typename T, bool Const = false>
+class SinglyLinkedListIterator {
+private:
+    template <typename, typename, typename> friend class SinglyLinkedList;
+    template <typename, bool> friend class SinglyLinkedListIterator;
+
+    using NodePtr = typename std::conditional<Const, const Node<T>*, Node<T>*>::type;
+
+    NodePtr current;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+
+    SinglyLinkedListIterator() : current(nullptr) {}
+    explicit SinglyLinkedListIterator(NodePtr node) : current(node) {}
+
+    // Неконстантный итератор приводится к константному
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    SinglyLinkedListIterator(const SinglyLinkedListIterator<T, OtherConst>& other) : current(other.current) {}
+
+    reference operator*() const {
+        return current->data; // Разыменование для доступа к данным
+    }
+
+    pointer operator->() const {
+        return &current->data;
+    }
+
+    SinglyLinkedListIterator& operator++() { // Префиксный инкремент
+        current = current->next;
+        return *this;
+    }
+
+    SinglyLinkedListIterator operator++(int) { // Постфиксный инкремент
+        SinglyLinkedListIterator old = *this;
+        current = current->next;
+        return old;
+    }
+
+    bool operator==(const SinglyLinkedListIterator& other) const {
+        return current == other.current;
+    }
+
+    bool operator!=(const SinglyLinkedListIterator& other) const {
+        return current != other.current; // Сравнение итераторов
+    }
+};
+
+// Allocator — аллокатор в стиле std::allocator; узлы выделяются через его rebind к Node<T>.
+// PoolAllocator (NodePool.h) нарезает узлы из непрерывных чанков вместо new на каждый узел.
+// Instrumentation — счетчики узлов, переходов и задержек (см. Instrumentation.h)
+template <typename T, typename Allocator = std::allocator<T>, typename Instrumentation = NoInstrumentation>
+class SinglyLinkedList {
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    Node<T>* head;
+    Node<T>* tail; // последний узел: push_back и append за O(1)
+    size_t length;
+    NodeAllocator alloc; // аллокатор узлов
+
+    template <typename... Args>
+    Node<T>* create_node(Args&&... args) {
+        Node<T>* node = NodeTraits::allocate(alloc, 1);
+        try {
+            NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc, node, 1);
+            throw;
+        }
+        Instrumentation::on_allocate(sizeof(Node<T>));
+        return node;
+    }
+
+    void destroy_node(Node<T>* node) {
+        NodeTraits::destroy(alloc, node);
+        NodeTraits::deallocate(alloc, node, 1);
+        Instrumentation::on_deallocate(sizeof(Node<T>));
+    }
+
+    // Узел с индексом index (index < length); проход от головы
+    Node<T>* node_at(size_t index) const {
+        typename Instrumentation::Scope scope(Operation::Seek);
+        Instrumentation::on_hops(index);
+        Node<T>* current = head;
+        for (size_t i = 0; i < index; ++i) {
+            current = current->next;
+        }
+        return current;
+    }
+
+    // Удаление всех узлов
+    void clear_nodes() {
+        while (head) {
+            Node<T>* temp = head;
+            head = head->next;
+            destroy_node(temp);
+        }
+        tail = nullptr;
+        length = 0;
+    }
+
+    void copy_from(const SinglyLinkedList& other) {
+        typename Instrumentation::Scope scope(Operation::Copy);
+        Instrumentation::on_copy(other.length);
+        Node<T>** link = &head; // куда подвесить следующий узел
+        for (Node<T>* current = other.head; current != nullptr; current = current->next) {
+            *link = create_node(current->data);
+            tail = *link;
+            link = &(*link)->next;
+            ++length;
+        }
+    }
+
+    // Подвешивание цепочки узлов other после узла prev (nullptr — в начало списка)
+    void link_after(Node<T>* prev, SinglyLinkedList& other) {
+        if (!other.head) return;
+        if (alloc != other.alloc) { // узлы чужого аллокатора забрать нельзя — переносим значения
+            SinglyLinkedList moved{Allocator(alloc)};
+            for (Node<T>* current = other.head; current != nullptr; current = current->next) {
+                moved.push_back(std::move(current->data));
+            }
+            other.clear_nodes();
+            link_after(prev, moved);
+            return;
+        }
+        Node<T>*& slot = prev ? prev->next : head;
+        other.tail->next = slot;
+        if (!slot) tail = other.tail; // вставка в конец
+        slot = other.head;
+        length += other.length;
+
+        other.head = other.tail = nullptr;
+        other.length = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using allocator_type = Allocator;
+    using iterator = SinglyLinkedListIterator<T>;
+    using const_iterator = SinglyLinkedListIterator<T, true>;
+
+    explicit SinglyLinkedList(const Allocator& allocator = Allocator())
+        : head(nullptr), tail(nullptr), length(0), alloc(allocator) {}
+
+    ~SinglyLinkedList() {
+        if constexpr (std::is_trivially_destructible<T>::value && is_pool_allocator<NodeAllocator>::value &&
+                      std::is_same<Instrumentation, NoInstrumentation>::value) {
+            if (alloc.exclusive()) return; // пул сам освободит все чанки, обходить узлы не нужно
+        }
+        clear_nodes();
+    }
+
+    SinglyLinkedList(const SinglyLinkedList& other)
+        : head(nullptr), tail(nullptr), length(0),
+          alloc(NodeTraits::select_on_container_copy_construction(other.alloc)) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear_nodes();
+            throw;
+        }
+    }
+
+    SinglyLinkedList(SinglyLinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), length(other.length), alloc(std::move(other.alloc)) {
+        other.head = nullptr; // Обнуляем перемещаемый объект
+        other.tail = nullptr;
+        other.length = 0;
+    }
+
+    SinglyLinkedList& operator=(const SinglyLinkedList& other) {
+        if (this == &other) return *this; // Проверка на самоприсваивание
+        clear_nodes();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+            alloc = other.alloc;
+        }
+        copy_from(other);
+        return *this;
+    }
+
+    SinglyLinkedList& operator=(SinglyLinkedList&& other)
+        noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value) {
+        if (this == &other) return *this; // Проверка на самоприсваивание
+        clear_nodes();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            alloc = std::move(other.alloc);
+        } else if (alloc != other.alloc) { // узлы чужого аллокатора забрать нельзя — копируем
+            copy_from(other);
+            return *this;
+        }
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.head = other.tail = nullptr;
+        other.length = 0;
+        return *this;
+    }
+
+    Allocator get_allocator() const {
+        return Allocator(alloc);
+    }
+
+    void push_back(const T& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        Node<T>* newNode = create_node(value);
+        if (!head) {
+            head = newNode;
+        } else {//если список не пуст, подвешиваем узел за хвостом без прохода по списку
+            tail->next = newNode;
+        }
+        tail = newNode;
+        ++length;
+    }
+
+    void push_back(T&& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        Node<T>* newNode = create_node(std::move(value));
+        if (!head) {
+            head = newNode;
+        } else {
+            tail->next = newNode;
+        }
+        tail = newNode;
+        ++length;
+    }
+
+    void push_front(const T& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        Node<T>* newNode = create_node(value);
+        newNode->next = head;
+        head = newNode;
+        if (!tail) tail = newNode;
+        ++length;
+    }
+
+    // Удаление первого элемента (извлечение из очереди)
+    void pop_front() {
+        if (!head) throw std::out_of_range("List is empty");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        Node<T>* temp = head;
+        head = head->next;
+        if (!head) tail = nullptr;
+        destroy_node(temp);
+        --length;
+    }
+
+    T& front() {
+        if (!head) throw std::out_of_range("List is empty");
+        return head->data;
+    }
+
+    T& back() {
+        if (!tail) throw std::out_of_range("List is empty");
+        return tail->data;
+    }
+
+    // Перенос всех узлов other в конец списка за O(1); other становится пустым
+    void append(SinglyLinkedList&& other) {
+        if (this == &other) return;
+        link_after(tail, other);
+    }
+
+    // Перенос всех узлов other сразу после позиции position за O(1)
+    void splice_after(const_iterator position, SinglyLinkedList& other) {
+        if (this == &other) return;
+        if (!position.current) throw std::out_of_range("Iterator out of range");
+        link_after(const_cast<Node<T>*>(position.current), other);
+    }
+
+    // Перенос всех узлов other после элемента с индексом index (поиск позиции — O(index))
+    void splice_after(size_t index, SinglyLinkedList& other) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        if (this == &other) return;
+        link_after(node_at(index), other);
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        if (index == length) { // вставка в конец — через хвост, без прохода
+            push_back(value);
+            return;
+        }
+        typename Instrumentation::Scope scope(Operation::Insert);
+        Node<T>* newNode = create_node(value);
+        if (index == 0) {
+            newNode->next = head;
+            head = newNode;
+        } else {
+            Node<T>* temp = node_at(index - 1);
+            newNode->next = temp->next;
+            temp->next = newNode;
+        }
+        ++length;
+    }
+
+    void insert_middle(const T& value) {
+        size_t middle_index = length / 2; // Вычисляем индекс середины списка
+        insert(middle_index, value); // Вставляем значение в середину
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        Node<T>* temp = head;
+        if (index == 0) {
+            head = head->next;
+            if (!head) tail = nullptr;
+            destroy_node(temp);
+        } else {
+            temp = node_at(index - 1);
+            Node<T>* toDelete = temp->next;
+            temp->next = toDelete->next;
+            if (toDelete == tail) tail = temp; // удален последний узел
+            destroy_node(toDelete);
+        }
+        --length;
+    }
+
+    // Применение журнала изменений (MutationBatch.h) за один проход от головы: удаленные узлы
+    // освобождаются, новые подвешиваются на место, оставшиеся узлы не копируются.
+    // Журнал должен быть записан для текущей длины; после применения он очищается
+    void apply(MutationBatch<T>&& batch) {
+        if (batch.base_size() != length) throw std::invalid_argument("Batch was recorded for a different size");
+        typename Instrumentation::Scope scope(Operation::Apply);
+        Instrumentation::on_hops(length);
+        Node<T>* prev = nullptr;    // последний узел готовой части списка
+        Node<T>* current = head;    // следующий необработанный исходный узел
+        size_t position = 0;        // его индекс среди исходных
+        auto drop_until = [&](size_t stop) { // удаление исходных узлов до индекса stop
+            for (; position < stop; ++position) {
+                Node<T>* next = current->next;
+                (prev ? prev->next : head) = next;
+                if (current == tail) tail = prev;
+                destroy_node(current);
+                current = next;
+                --length;
+            }
+        };
+        batch.for_each_segment(
+            [&](size_t start, size_t count) {
+                drop_until(start);
+                for (size_t i = 0; i < count; ++i) {
+                    prev = current;
+                    current = current->next;
+                }
+                position += count;
+            },
+            [&](T& value) {
+                Node<T>* node = create_node(std::move(value));
+                node->next = current;
+                (prev ? prev->next : head) = node;
+                if (!current) tail = node;
+                prev = node;
+                ++length;
+            });
+        drop_until(batch.base_size());
+        batch.clear(length);
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+    iterator begin() {
+        return iterator(head); // Возвращаем итератор на голову
+    }
+
+    iterator end() {
+        return iterator(nullptr); // Возвращаем итератор на nullptr
+    }
+
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    void print() const {
+        Node<T>* temp = head;
+        while (temp) {
+            std::cout << temp->data << (temp->next ? ", " : "");
+            temp = temp->next;
+        }
+        std::cout << std::endl;
+    }
+
+    // То же, что print(), но через буфер OutputFormat.h: в поток, дескриптор или BufferedWriter
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};
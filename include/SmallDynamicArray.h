@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ArrayView.h"
+#include "GrowthPolicy.h"
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+// Динамический массив с встроенным буфером (small buffer optimization): первые N элементов
+// хранятся прямо в объекте, куча используется только когда элементов становится больше N.
+// Интерфейс повторяет DynamicArray; маленькие массивы создаются, копируются и разрушаются
+// без обращений к аллокатору. Перемещение встроенного массива переносит элементы поштучно.
+template <typename T, size_t N = 16, typename GrowthPolicy = GrowthFactor1_5, typename Instrumentation = NoInstrumentation>
+class SmallDynamicArray {
+    static_assert(N > 0, "Inline capacity must be positive");
+
+private:
+    alignas(T) unsigned char buffer[sizeof(T) * N]; // встроенное хранилище на N элементов
+    T* elements; // buffer или память в куче
+    size_t capacity;
+    size_t length;
+
+    // Те же правила, что в DynamicArray: побайтовый перенос и realloc для тривиальных типов,
+    // operator new с выравниванием для типов, которым не хватает выравнивания malloc
+    static constexpr bool trivially_relocatable =
+        std::is_trivially_copyable<T>::value && alignof(T) <= alignof(std::max_align_t);
+    static constexpr bool over_aligned = alignof(T) > alignof(std::max_align_t);
+
+    T* inline_data() { return reinterpret_cast<T*>(buffer); }
+
+    bool on_heap() const { return elements != reinterpret_cast<const T*>(buffer); }
+
+    static T* allocate(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+        void* p;
+        if constexpr (over_aligned) {
+            p = ::operator new(n * sizeof(T), std::align_val_t(alignof(T)));
+        } else {
+            p = std::malloc(n * sizeof(T));
+            if (!p) throw std::bad_alloc();
+        }
+        Instrumentation::on_allocate(n * sizeof(T));
+        return static_cast<T*>(p);
+    }
+
+    static void deallocate(T* p, size_t n) {
+        Instrumentation::on_deallocate(n * sizeof(T));
+        if constexpr (over_aligned) {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+        } else {
+            std::free(p);
+        }
+    }
+
+    static void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) first->~T();
+        }
+    }
+
+    // Перенос n элементов в неинициализированную память dest с разрушением исходных
+    static void relocate(T* first, size_t n, T* dest) {
+        Instrumentation::on_move(n);
+        if constexpr (trivially_relocatable) {
+            if (n) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+        } else {
+            std::uninitialized_move(first, first + n, dest);
+            destroy(first, first + n);
+        }
+    }
+
+    // Перенос элементов в хранилище емкостью new_capacity: в кучу или обратно во встроенный буфер
+    void reallocate(size_t new_capacity) {
+        bool to_inline = new_capacity <= N;
+        if (to_inline && !on_heap()) return; // уже во встроенном буфере
+        Instrumentation::on_reallocate();
+        if constexpr (trivially_relocatable) {
+            if (!to_inline && on_heap()) { // куча -> куча: realloc может расширить блок на месте
+                if (new_capacity > static_cast<size_t>(-1) / sizeof(T)) throw std::bad_array_new_length();
+                void* p = std::realloc(elements, new_capacity * sizeof(T));
+                if (!p) throw std::bad_alloc();
+                Instrumentation::on_deallocate(capacity * sizeof(T));
+                Instrumentation::on_allocate(new_capacity * sizeof(T));
+                Instrumentation::on_move(length);
+                elements = static_cast<T*>(p);
+                capacity = new_capacity;
+                return;
+            }
+        }
+        T* new_data = to_inline ? inline_data() : allocate(new_capacity);
+        if constexpr (trivially_relocatable) {
+            relocate(elements, length, new_data);
+        } else {
+            try {
+                std::uninitialized_move(elements, elements + length, new_data);
+            } catch (...) {
+                if (!to_inline) deallocate(new_data, new_capacity);
+                throw;
+            }
+            Instrumentation::on_move(length);
+            destroy(elements, elements + length);
+        }
+        if (on_heap()) deallocate(elements, capacity);
+        elements = new_data;
+        capacity = to_inline ? N : new_capacity;
+    }
+
+    void grow(size_t required) {
+        reallocate(GrowthPolicy::next_capacity(capacity, required, sizeof(T)));
+    }
+
+    // Копирование элементов other в пустой массив
+    void copy_from(const SmallDynamicArray& other) {
+        typename Instrumentation::Scope scope(Operation::Copy);
+        if (other.length > capacity) {
+            elements = allocate(other.length);
+            capacity = other.length;
+        }
+        std::uninitialized_copy(other.elements, other.elements + other.length, elements);
+        Instrumentation::on_copy(other.length);
+        length = other.length;
+    }
+
+    // Захват элементов other в пустой массив с встроенным буфером; other остается пустым
+    void steal_from(SmallDynamicArray& other) {
+        if (other.on_heap()) { // память в куче забираем целиком
+            elements = other.elements;
+            capacity = other.capacity;
+            length = other.length;
+            other.elements = other.inline_data();
+            other.capacity = N;
+        } else {
+            relocate(other.elements, other.length, elements);
+            length = other.length;
+        }
+        other.length = 0;
+    }
+
+    void release() {
+        destroy(elements, elements + length);
+        if (on_heap()) deallocate(elements, capacity);
+        elements = inline_data();
+        capacity = N;
+        length = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static const size_t inline_capacity = N;
+
+    SmallDynamicArray() : elements(inline_data()), capacity(N), length(0) {}
+
+    ~SmallDynamicArray() {
+        destroy(elements, elements + length);
+        if (on_heap()) deallocate(elements, capacity);
+    }
+
+    SmallDynamicArray(const SmallDynamicArray& other) : elements(inline_data()), capacity(N), length(0) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            if (on_heap()) deallocate(elements, capacity);
+            throw;
+        }
+    }
+
+    SmallDynamicArray(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : elements(inline_data()), capacity(N), length(0) {
+        steal_from(other);
+    }
+
+    SmallDynamicArray& operator=(const SmallDynamicArray& other) {
+        if (this == &other) return *this;
+        if (other.length <= capacity) { // хватает текущего хранилища — куча не нужна
+            clear();
+            typename Instrumentation::Scope scope(Operation::Copy);
+            std::uninitialized_copy(other.elements, other.elements + other.length, elements);
+            Instrumentation::on_copy(other.length);
+            length = other.length;
+        } else {
+            SmallDynamicArray copy(other);
+            release();
+            steal_from(copy);
+        }
+        return *this;
+    }
+
+    SmallDynamicArray& operator=(SmallDynamicArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this == &other) return *this;
+        release();
+        steal_from(other);
+        return *this;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        if (length == capacity) {
+            T tmp(std::forward<Args>(args)...); // аргументы могут ссылаться на элементы самого массива
+            grow(length + 1);
+            ::new (static_cast<void*>(elements + length)) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(elements + length)) T(std::forward<Args>(args)...);
+        }
+        return elements[length++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        elements[--length].~T();
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        if (index == length) {
+            emplace_back(value);
+            return;
+        }
+        typename Instrumentation::Scope scope(Operation::Insert);
+        T tmp(value);
+        if (length == capacity) grow(length + 1);
+        Instrumentation::on_move(length - index);
+        ::new (static_cast<void*>(elements + length)) T(std::move(elements[length - 1]));
+        std::move_backward(elements + index, elements + length - 1, elements + length);
+        elements[index] = std::move(tmp);
+        ++length;
+    }
+
+    void insert_middle(const T& value) {
+        insert(length / 2, value);
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        typename Instrumentation::Scope scope(Operation::Erase);
+        Instrumentation::on_move(length - index - 1);
+        std::move(elements + index + 1, elements + length, elements + index);
+        elements[--length].~T();
+    }
+
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity) {
+            typename Instrumentation::Scope scope(Operation::Resize);
+            reallocate(new_capacity);
+        }
+    }
+
+    void resize(size_t new_length) {
+        typename Instrumentation::Scope scope(Operation::Resize);
+        if (new_length > capacity) reallocate(new_length);
+        for (; length < new_length; ++length) ::new (static_cast<void*>(elements + length)) T();
+        if (new_length < length) {
+            destroy(elements + new_length, elements + length);
+            length = new_length;
+        }
+    }
+
+    // Удаление всех элементов; емкость сохраняется
+    void clear() {
+        destroy(elements, elements + length);
+        length = 0;
+    }
+
+    // Возврат во встроенный буфер, если элементы в нем помещаются
+    void shrink_to_fit() {
+        if (on_heap() && length < capacity) {
+            typename Instrumentation::Scope scope(Operation::Resize);
+            reallocate(length);
+        }
+    }
+
+    // true, пока элементы хранятся во встроенном буфере
+    bool is_inline() const { return !on_heap(); }
+
+    size_t getCapacity() const { return capacity; }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    const T& get(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return elements[index];
+    }
+
+    T& operator[](size_t index) {
+        assert(index < length);
+        return elements[index];
+    }
+
+    const T& operator[](size_t index) const {
+        assert(index < length);
+        return elements[index];
+    }
+
+    T& at(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return elements[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        return elements[index];
+    }
+
+    T& front() {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return elements[0];
+    }
+
+    const T& front() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return elements[0];
+    }
+
+    T& back() {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return elements[length - 1];
+    }
+
+    const T& back() const {
+        if (length == 0) throw std::out_of_range("Array is empty");
+        return elements[length - 1];
+    }
+
+    T* data() { return elements; }
+    const T* data() const { return elements; }
+
+    // Невладеющее представление; недействительно после перевыделения и после перемещения массива
+    ArrayView<T> view() { return ArrayView<T>(elements, length); }
+    ArrayView<const T> view() const { return ArrayView<const T>(elements, length); }
+
+    iterator begin() { return elements; }
+    iterator end() { return elements + length; }
+    const_iterator begin() const { return elements; }
+    const_iterator end() const { return elements + length; }
+    const_iterator cbegin() const { return elements; }
+    const_iterator cend() const { return elements + length; }
+
+    void print() const {
+        for (size_t i = 0; i < length; ++i) {
+            std::cout << elements[i] << (i < length - 1 ? ", " : "");
+        }
+        std::cout << std::endl;
+    }
+
+    // Как DynamicArray::write_to
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "ArrayView.h"
+#include "DynamicArray.h"
+#include "OutputFormat.h"
+
+// Массив записей в виде «структуры массивов» (structure of arrays): каждое поле записи
+// хранится в своем непрерывном столбце (DynamicArray<Field>). Проход по одному полю читает
+// только его столбец, а не записи целиком, как у DynamicArray<Record>; столбец отдается как
+// ArrayView и подходит для кернелов BulkOps.h. Строка доступна через прокси-ссылку:
+// array[i].get<I>() — ссылка на поле, array[i] = std::make_tuple(...) — запись всей строки.
+// insert/erase сдвигают хвост в каждом столбце, как у DynamicArray.
+// Столбцы растут по одной политике (GrowthFactor1_5) и с одинаковой начальной емкости,
+// поэтому их емкости всегда совпадают.
+template <typename... Fields>
+class SoADynamicArray {
+    static_assert(sizeof...(Fields) > 0, "At least one field is required");
+
+public:
+    static constexpr size_t field_count = sizeof...(Fields);
+
+    template <size_t I>
+    using field_type = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+    using value_type = std::tuple<Fields...>; // строка по значению
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    using Indices = std::index_sequence_for<Fields...>;
+
+    std::tuple<DynamicArray<Fields>...> columns;
+
+    template <size_t I>
+    DynamicArray<field_type<I>>& column_array() { return std::get<I>(columns); }
+
+    template <size_t I>
+    const DynamicArray<field_type<I>>& column_array() const { return std::get<I>(columns); }
+
+    // Вставка строки во все столбцы; если столбец бросил исключение,
+    // из уже заполненных столбцов вставка убирается, и длины снова равны
+    template <size_t... I>
+    void insert_row(size_t index, const std::tuple<const Fields&...>& values, std::index_sequence<I...>) {
+        size_t done = 0;
+        try {
+            ((column_array<I>().insert(index, std::get<I>(values)), ++done), ...);
+        } catch (...) {
+            ((I < done ? column_array<I>().erase(index) : void()), ...);
+            throw;
+        }
+    }
+
+    template <size_t... I>
+    void erase_row(size_t index, std::index_sequence<I...>) {
+        (column_array<I>().erase(index), ...);
+    }
+
+    template <size_t... I>
+    value_type load_row(size_t index, std::index_sequence<I...>) const {
+        return value_type(column_array<I>()[index]...);
+    }
+
+    template <size_t... I>
+    void store_row(size_t index, const value_type& values, std::index_sequence<I...>) {
+        ((column_array<I>()[index] = std::get<I>(values)), ...);
+    }
+
+    template <typename F, size_t... I>
+    void for_each_column(F&& f, std::index_sequence<I...>) {
+        (f(column_array<I>()), ...);
+    }
+
+    template <typename Sink, size_t... I>
+    void write_row(BufferedWriter<Sink>& writer, size_t index, const OutputFormat& format,
+                   std::index_sequence<I...>) const {
+        writer.append(format.prefix);
+        ((I > 0 ? writer.append(format.separator) : void(), writer.append_value(column_array<I>()[index], format.quoting)),
+         ...);
+        writer.append(format.suffix);
+    }
+
+    template <size_t... I>
+    void print_row(size_t index, std::index_sequence<I...>) const {
+        std::cout << "(";
+        ((std::cout << (I > 0 ? ", " : "") << column_array<I>()[index]), ...);
+        std::cout << ")";
+    }
+
+public:
+    // Прокси-ссылка на строку: хранит массив и индекс, поля читаются из столбцов по запросу.
+    // Действует, пока строка не сдвинута вставкой или удалением
+    template <bool Const>
+    class RowReference {
+    private:
+        using Owner = typename std::conditional<Const, const SoADynamicArray, SoADynamicArray>::type;
+
+        Owner* array;
+        size_t index;
+
+    public:
+        RowReference(Owner* owner, size_t position) : array(owner), index(position) {}
+
+        // Неконстантная ссылка приводится к константной
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        RowReference(const RowReference<OtherConst>& other) : array(other.owner()), index(other.position()) {}
+
+        Owner* owner() const { return array; }
+        size_t position() const { return index; }
+
+        template <size_t I>
+        auto& get() const { return array->template column_array<I>()[index]; }
+
+        // Копия строки
+        operator value_type() const { return array->load_row(index, Indices()); }
+
+        // Присваивание меняет поля строки, а не то, на какую строку указывает ссылка
+        template <bool C = Const, typename = typename std::enable_if<!C>::type>
+        const RowReference& operator=(const value_type& values) const {
+            array->store_row(index, values, Indices());
+            return *this;
+        }
+
+        const RowReference& operator=(const RowReference& other) const {
+            static_assert(!Const, "Cannot assign through a const row reference");
+            return *this = value_type(other);
+        }
+    };
+
+    using reference = RowReference<false>;
+    using const_reference = RowReference<true>;
+
+    // Итератор по строкам; разыменование возвращает прокси-ссылку по значению,
+    // поэтому категория — input iterator, хотя арифметика произвольного доступа есть
+    template <bool Const>
+    class RowIterator {
+    private:
+        using Owner = typename std::conditional<Const, const SoADynamicArray, SoADynamicArray>::type;
+
+        Owner* array;
+        size_t index;
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = SoADynamicArray::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = RowReference<Const>;
+
+        RowIterator() : array(nullptr), index(0) {}
+        RowIterator(Owner* owner, size_t position) : array(owner), index(position) {}
+
+        reference operator*() const { return reference(array, index); }
+        reference operator[](difference_type n) const { return reference(array, index + n); }
+
+        RowIterator& operator++() { ++index; return *this; }
+        RowIterator operator++(int) { RowIterator old = *this; ++index; return old; }
+        RowIterator& operator--() { --index; return *this; }
+        RowIterator operator--(int) { RowIterator old = *this; --index; return old; }
+        RowIterator& operator+=(difference_type n) { index += n; return *this; }
+        RowIterator& operator-=(difference_type n) { index -= n; return *this; }
+        RowIterator operator+(difference_type n) const { return RowIterator(array, index + n); }
+        RowIterator operator-(difference_type n) const { return RowIterator(array, index - n); }
+        difference_type operator-(const RowIterator& other) const {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const RowIterator& other) const { return index == other.index; }
+        bool operator!=(const RowIterator& other) const { return index != other.index; }
+        bool operator<(const RowIterator& other) const { return index < other.index; }
+    };
+
+    using iterator = RowIterator<false>;
+    using const_iterator = RowIterator<true>;
+
+    // Начальная емкость каждого столбца — как у DynamicArray (10)
+    SoADynamicArray(size_t initial_capacity = 10) : columns(DynamicArray<Fields>(initial_capacity)...) {}
+
+    void push_back(const Fields&... values) {
+        insert_row(size(), std::tuple<const Fields&...>(values...), Indices());
+    }
+
+    void push_back(const value_type& row) {
+        insert_row(size(), std::tuple<const Fields&...>(row), Indices());
+    }
+
+    void insert(size_t index, const Fields&... values) {
+        if (index > size()) throw std::out_of_range("Index out of range");
+        insert_row(index, std::tuple<const Fields&...>(values...), Indices());
+    }
+
+    void insert(size_t index, const value_type& row) {
+        if (index > size()) throw std::out_of_range("Index out of range");
+        insert_row(index, std::tuple<const Fields&...>(row), Indices());
+    }
+
+    void insert_middle(const Fields&... values) {
+        insert(size() / 2, values...);
+    }
+
+    void insert_middle(const value_type& row) {
+        insert(size() / 2, row);
+    }
+
+    void erase(size_t index) {
+        if (index >= size()) throw std::out_of_range("Index out of range");
+        erase_row(index, Indices());
+    }
+
+    // Резервирование памяти минимум под new_capacity строк в каждом столбце
+    void reserve(size_t new_capacity) {
+        for_each_column([new_capacity](auto& column) { column.reserve(new_capacity); }, Indices());
+    }
+
+    // Новые строки заполняются значениями полей по умолчанию
+    void resize(size_t new_length) {
+        for_each_column([new_length](auto& column) { column.resize(new_length); }, Indices());
+    }
+
+    // Удаление всех строк; емкость сохраняется
+    void clear() {
+        for_each_column([](auto& column) { column.clear(); }, Indices());
+    }
+
+    void shrink_to_fit() {
+        for_each_column([](auto& column) { column.shrink_to_fit(); }, Indices());
+    }
+
+    size_t getCapacity() const { return std::get<0>(columns).getCapacity(); }
+    size_t size() const { return std::get<0>(columns).size(); }
+    bool empty() const { return size() == 0; }
+
+    // Столбец поля I целиком; недействителен после перевыделения памяти
+    template <size_t I>
+    ArrayView<field_type<I>> column() { return column_array<I>().view(); }
+
+    template <size_t I>
+    ArrayView<const field_type<I>> column() const { return column_array<I>().view(); }
+
+    // Доступ к строке без проверки границ (assert — только в отладочной сборке)
+    reference operator[](size_t index) {
+        assert(index < size());
+        return reference(this, index);
+    }
+
+    const_reference operator[](size_t index) const {
+        assert(index < size());
+        return const_reference(this, index);
+    }
+
+    reference at(size_t index) {
+        if (index >= size()) throw std::out_of_range("Index out of range");
+        return reference(this, index);
+    }
+
+    const_reference at(size_t index) const {
+        if (index >= size()) throw std::out_of_range("Index out of range");
+        return const_reference(this, index);
+    }
+
+    // Копия строки с проверкой границ
+    value_type get(size_t index) const {
+        if (index >= size()) throw std::out_of_range("Index out of range");
+        return load_row(index, Indices());
+    }
+
+    reference front() {
+        if (empty()) throw std::out_of_range("Array is empty");
+        return reference(this, 0);
+    }
+
+    const_reference front() const {
+        if (empty()) throw std::out_of_range("Array is empty");
+        return const_reference(this, 0);
+    }
+
+    reference back() {
+        if (empty()) throw std::out_of_range("Array is empty");
+        return reference(this, size() - 1);
+    }
+
+    const_reference back() const {
+        if (empty()) throw std::out_of_range("Array is empty");
+        return const_reference(this, size() - 1);
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // Строки в виде (a, b, c) через запятую
+    void print() const {
+        for (size_t i = 0; i < size(); ++i) {
+            print_row(i, Indices());
+            std::cout << (i < size() - 1 ? ", " : "");
+        }
+        std::cout << std::endl;
+    }
+
+    // Буферизованный вывод (см. OutputFormat.h): format применяется к каждой строке, то есть
+    // prefix, поля через separator и suffix. csv() дает по строке CSV на запись, json() —
+    // по массиву JSON на строку
+    template <typename Sink>
+    void write_to(BufferedWriter<Sink>& writer, const OutputFormat& format = OutputFormat::csv()) const {
+        for (size_t i = 0; i < size(); ++i) write_row(writer, i, format, Indices());
+    }
+
+    void write_to(std::ostream& out, const OutputFormat& format = OutputFormat::csv()) const {
+        BufferedWriter<StreamSink> writer{StreamSink(out)};
+        write_to(writer, format);
+        writer.flush();
+    }
+
+    void write_to(int fd, const OutputFormat& format = OutputFormat::csv()) const {
+        BufferedWriter<FileDescriptorSink> writer{FileDescriptorSink(fd)};
+        write_to(writer, format);
+        writer.flush();
+    }
+};
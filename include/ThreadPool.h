@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Пул потоков с перехватом работы (work stealing) для рекурсивного параллелизма fork-join.
+// У каждого рабочего потока своя очередь: владелец кладет и берет задачи с конца,
+// простаивающие потоки крадут с начала (там лежат самые крупные куски работы).
+// Поток, вызвавший invoke() снаружи, тоже участвует в работе, поэтому пул из threads
+// участников держит threads - 1 фоновых потоков, а пул из одного участника работает последовательно.
+class ThreadPool {
+private:
+    // Задача живет на стеке породившего ее вызова invoke(), пока не будет выполнена
+    struct Task {
+        void (*run)(Task*);
+        std::atomic<bool> done;
+        std::exception_ptr error;
+
+        explicit Task(void (*function)(Task*)) : run(function), done(false) {}
+
+        void execute() {
+            try {
+                run(this);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            done.store(true, std::memory_order_release);
+        }
+    };
+
+    template <typename F>
+    struct FunctionTask : Task {
+        F& function;
+
+        explicit FunctionTask(F& f) : Task(&FunctionTask::call), function(f) {}
+
+        static void call(Task* task) { static_cast<FunctionTask*>(task)->function(); }
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task*> tasks;
+    };
+
+    // Очереди 0..workers-1 принадлежат фоновым потокам, последняя — общая для внешних потоков
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued;   // задач во всех очередях
+    std::atomic<size_t> sleeping; // потоков, ждущих на wake
+    std::atomic<bool> stopping;
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+
+    struct Membership { // к какому пулу и очереди относится текущий поток
+        const ThreadPool* pool;
+        size_t queue;
+    };
+
+    static Membership& membership() {
+        thread_local Membership current = {nullptr, 0};
+        return current;
+    }
+
+    size_t home_queue() const {
+        const Membership& current = membership();
+        return current.pool == this ? current.queue : queues.size() - 1;
+    }
+
+    void push(size_t queue, Task* task) {
+        {
+            std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+            queues[queue]->tasks.push_back(task);
+        }
+        queued.fetch_add(1);
+        if (sleeping.load() > 0) {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            wake.notify_one();
+        }
+    }
+
+    // Забирает task обратно, если его еще никто не украл
+    bool take_back(size_t queue, Task* task) {
+        std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+        std::deque<Task*>& tasks = queues[queue]->tasks;
+        for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+            if (*it == task) {
+                tasks.erase(std::next(it).base());
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Своя очередь — с конца, чужие — с начала
+    Task* find_task(size_t home) {
+        {
+            std::lock_guard<std::mutex> lock(queues[home]->mutex);
+            if (!queues[home]->tasks.empty()) {
+                Task* task = queues[home]->tasks.back();
+                queues[home]->tasks.pop_back();
+                queued.fetch_sub(1);
+                return task;
+            }
+        }
+        for (size_t i = 1; i < queues.size(); ++i) {
+            Queue& victim = *queues[(home + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                Task* task = victim.tasks.front();
+                victim.tasks.pop_front();
+                queued.fetch_sub(1);
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    void worker_loop(size_t index) {
+        membership() = Membership{this, index};
+        while (!stopping.load(std::memory_order_acquire)) {
+            if (Task* task = find_task(index)) {
+                task->execute();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleeping.fetch_add(1);
+            wake.wait(lock, [this] { return queued.load() > 0 || stopping.load(); });
+            sleeping.fetch_sub(1);
+        }
+    }
+
+public:
+    // threads — число участников вместе с вызывающим потоком; 0 — по числу ядер
+    explicit ThreadPool(size_t threads = 0) : queued(0), sleeping(0), stopping(false) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 0; i < threads; ++i) queues.emplace_back(new Queue());
+        for (size_t i = 0; i + 1 < threads; ++i) workers.emplace_back(&ThreadPool::worker_loop, this, i);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping.store(true);
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    // Общий пул по числу ядер
+    static ThreadPool& global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    size_t size() const { return queues.size(); }
+
+    // Выполняет a и b, возможно параллельно, и возвращается после завершения обоих.
+    // b выставляется на кражу, a выполняется сразу; пока b выполняет другой поток,
+    // текущий поток берет другие задачи вместо простоя. Исключение из a или b пробрасывается.
+    template <typename A, typename B>
+    void invoke(A&& a, B&& b) {
+        if (workers.empty()) {
+            a();
+            b();
+            return;
+        }
+
+        FunctionTask<B> task(b);
+        size_t home = home_queue();
+        push(home, &task);
+
+        std::exception_ptr error;
+        try {
+            a();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        if (take_back(home, &task)) {
+            if (!error) b();
+        } else {
+            while (!task.done.load(std::memory_order_acquire)) {
+                if (Task* other = find_task(home)) other->execute();
+                else std::this_thread::yield();
+            }
+            if (!error) error = task.error;
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    // Делит [first, last) пополам, пока кусок длиннее grain, и вызывает body(begin, end) для кусков
+    template <typename Body>
+    void parallel_for(size_t first, size_t last, size_t grain, const Body& body) {
+        if (grain == 0) grain = 1;
+        if (last - first <= grain || workers.empty()) {
+            body(first, last);
+            return;
+        }
+        size_t middle = first + (last - first) / 2;
+        invoke([&] { parallel_for(first, middle, grain, body); },
+               [&] { parallel_for(middle, last, grain, body); });
+    }
+};
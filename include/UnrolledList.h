@@ -0,0 +1,425 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Instrumentation.h"
+#include "OutputFormat.h"
+
+// Узел развернутого списка: до ChunkSize элементов подряд в одном блоке памяти.
+// Пустых узлов в списке не бывает.
+template <typename T, size_t ChunkSize>
+struct UnrolledChunk {
+    UnrolledChunk* next;
+    UnrolledChunk* prev;
+    size_t count; // сколько элементов занято
+    alignas(T) unsigned char storage[sizeof(T) * ChunkSize]; // неинициализированное место под элементы
+
+    UnrolledChunk() : next(nullptr), prev(nullptr), count(0) {}
+
+    T* items() { return reinterpret_cast<T*>(storage); }
+    const T* items() const { return reinterpret_cast<const T*>(storage); }
+};
+
+// Двунаправленный итератор: узел + позиция в нем.
+// end() указывает на позицию за последним элементом последнего узла, поэтому от него можно сделать --.
+template <typename T, size_t ChunkSize, bool Const>
+class UnrolledListIterator {
+private:
+    template <typename, size_t, typename, typename> friend class UnrolledList;
+    template <typename, size_t, bool> friend class UnrolledListIterator;
+
+    using Chunk = typename std::conditional<Const, const UnrolledChunk<T, ChunkSize>, UnrolledChunk<T, ChunkSize>>::type;
+
+    Chunk* chunk;
+    size_t offset;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = typename std::conditional<Const, const T*, T*>::type;
+    using reference = typename std::conditional<Const, const T&, T&>::type;
+
+    UnrolledListIterator() : chunk(nullptr), offset(0) {}
+    UnrolledListIterator(Chunk* c, size_t o) : chunk(c), offset(o) {}
+
+    // Неконстантный итератор приводится к константному
+    template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+    UnrolledListIterator(const UnrolledListIterator<T, ChunkSize, OtherConst>& other)
+        : chunk(other.chunk), offset(other.offset) {}
+
+    reference operator*() const { return chunk->items()[offset]; }
+    pointer operator->() const { return chunk->items() + offset; }
+
+    UnrolledListIterator& operator++() {
+        if (++offset == chunk->count && chunk->next) { // конец узла — переходим в следующий
+            chunk = chunk->next;
+            offset = 0;
+        }
+        return *this;
+    }
+
+    UnrolledListIterator operator++(int) {
+        UnrolledListIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    UnrolledListIterator& operator--() {
+        if (offset == 0) { // начало узла — переходим в конец предыдущего
+            chunk = chunk->prev;
+            offset = chunk->count;
+        }
+        --offset;
+        return *this;
+    }
+
+    UnrolledListIterator operator--(int) {
+        UnrolledListIterator old = *this;
+        --*this;
+        return old;
+    }
+
+    bool operator==(const UnrolledListIterator& other) const {
+        return chunk == other.chunk && offset == other.offset;
+    }
+
+    bool operator!=(const UnrolledListIterator& other) const {
+        return !(*this == other);
+    }
+};
+
+// Развернутый (блочный) список: двусвязный список узлов, каждый из которых хранит
+// до ChunkSize элементов. Обход идет по непрерывным блокам, вставка в середину
+// сдвигает не больше ChunkSize элементов. Переполненный узел делится пополам,
+// малозаполненные соседние узлы сливаются при удалении.
+// Instrumentation — счетчики узлов, переходов и задержек (см. Instrumentation.h)
+template <typename T, size_t ChunkSize = 64, typename Allocator = std::allocator<T>,
+          typename Instrumentation = NoInstrumentation>
+class UnrolledList {
+    static_assert(ChunkSize >= 2, "Chunk must hold at least two elements");
+
+private:
+    using Chunk = UnrolledChunk<T, ChunkSize>;
+    using ChunkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+    using ChunkTraits = std::allocator_traits<ChunkAllocator>;
+
+    Chunk* head; // первый узел
+    Chunk* tail; // последний узел
+    size_t length; // общее количество элементов
+    ChunkAllocator alloc; // аллокатор узлов
+
+    Chunk* create_chunk() {
+        Chunk* chunk = ChunkTraits::allocate(alloc, 1);
+        ::new (static_cast<void*>(chunk)) Chunk();
+        Instrumentation::on_allocate(sizeof(Chunk));
+        return chunk;
+    }
+
+    void deallocate_chunk(Chunk* chunk) {
+        chunk->~Chunk();
+        ChunkTraits::deallocate(alloc, chunk, 1);
+        Instrumentation::on_deallocate(sizeof(Chunk));
+    }
+
+    // Разрушение элементов узла и освобождение памяти
+    void destroy_chunk(Chunk* chunk) {
+        T* items = chunk->items();
+        for (size_t i = 0; i < chunk->count; ++i) items[i].~T();
+        deallocate_chunk(chunk);
+    }
+
+    // Подвешивание узла chunk после position (nullptr — в начало)
+    void link_after(Chunk* position, Chunk* chunk) {
+        chunk->prev = position;
+        chunk->next = position ? position->next : head;
+        if (chunk->next) chunk->next->prev = chunk; else tail = chunk;
+        if (position) position->next = chunk; else head = chunk;
+    }
+
+    void unlink_chunk(Chunk* chunk) {
+        if (chunk->prev) chunk->prev->next = chunk->next; else head = chunk->next;
+        if (chunk->next) chunk->next->prev = chunk->prev; else tail = chunk->prev;
+        destroy_chunk(chunk);
+    }
+
+    // Поиск узла, содержащего элемент index (index < length), с ближайшего конца списка.
+    // В offset возвращается позиция элемента внутри узла.
+    Chunk* locate(size_t index, size_t& offset) const {
+        typename Instrumentation::Scope scope(Operation::Seek);
+        Chunk* chunk;
+        size_t hops = 0;
+        if (index < length / 2) {
+            chunk = head;
+            while (index >= chunk->count) {
+                index -= chunk->count;
+                chunk = chunk->next;
+                ++hops;
+            }
+            offset = index;
+        } else {
+            size_t from_end = length - index; // номер элемента с конца, начиная с 1
+            chunk = tail;
+            while (from_end > chunk->count) {
+                from_end -= chunk->count;
+                chunk = chunk->prev;
+                ++hops;
+            }
+            offset = chunk->count - from_end;
+        }
+        Instrumentation::on_hops(hops);
+        return chunk;
+    }
+
+    // Деление полного узла пополам: верхняя половина уезжает в новый узел
+    void split(Chunk* chunk) {
+        Chunk* fresh = create_chunk();
+        size_t keep = chunk->count / 2;
+        T* items = chunk->items();
+        Instrumentation::on_move(chunk->count - keep);
+        std::uninitialized_move(items + keep, items + chunk->count, fresh->items());
+        for (size_t i = keep; i < chunk->count; ++i) items[i].~T();
+        fresh->count = chunk->count - keep;
+        chunk->count = keep;
+        link_after(chunk, fresh);
+    }
+
+    // Слияние узла second в конец first (элементы помещаются в first)
+    void merge(Chunk* first, Chunk* second) {
+        Instrumentation::on_move(second->count);
+        std::uninitialized_move(second->items(), second->items() + second->count, first->items() + first->count);
+        first->count += second->count;
+        unlink_chunk(second); // разрушит перемещенные элементы second
+    }
+
+    // После удаления: малозаполненный узел сливается с соседом, если вместе они займут не больше 3/4 узла
+    void rebalance(Chunk* chunk) {
+        if (chunk->count >= ChunkSize / 2) return;
+        const size_t limit = ChunkSize * 3 / 4;
+        if (chunk->next && chunk->count + chunk->next->count <= limit) {
+            merge(chunk, chunk->next);
+        } else if (chunk->prev && chunk->prev->count + chunk->count <= limit) {
+            merge(chunk->prev, chunk);
+        }
+    }
+
+    // Вставка в узел, где есть свободное место, на позицию offset
+    void insert_into(Chunk* chunk, size_t offset, T&& value) {
+        T* items = chunk->items();
+        if (offset == chunk->count) {
+            ::new (static_cast<void*>(items + offset)) T(std::move(value));
+        } else {
+            Instrumentation::on_move(chunk->count - offset);
+            ::new (static_cast<void*>(items + chunk->count)) T(std::move(items[chunk->count - 1]));
+            std::move_backward(items + offset, items + chunk->count - 1, items + chunk->count);
+            items[offset] = std::move(value);
+        }
+        ++chunk->count;
+        ++length;
+    }
+
+    // Добавление в конец без замера (для push_back и копирования)
+    void append(T&& value) {
+        if (tail && tail->count < ChunkSize) {
+            insert_into(tail, tail->count, std::move(value));
+            return;
+        }
+        // Последний узел заполнен: новый узел подвешивается только после успешного создания элемента
+        Chunk* chunk = create_chunk();
+        try {
+            ::new (static_cast<void*>(chunk->items())) T(std::move(value));
+        } catch (...) {
+            deallocate_chunk(chunk);
+            throw;
+        }
+        chunk->count = 1;
+        link_after(tail, chunk);
+        ++length;
+    }
+
+    void copy_from(const UnrolledList& other) {
+        typename Instrumentation::Scope scope(Operation::Copy);
+        Instrumentation::on_copy(other.length);
+        for (const T& value : other) append(T(value));
+    }
+
+    void clear_chunks() {
+        while (head) {
+            Chunk* temp = head;
+            head = head->next;
+            destroy_chunk(temp);
+        }
+        tail = nullptr;
+        length = 0;
+    }
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using allocator_type = Allocator;
+    using iterator = UnrolledListIterator<T, ChunkSize, false>;
+    using const_iterator = UnrolledListIterator<T, ChunkSize, true>;
+
+    explicit UnrolledList(const Allocator& allocator = Allocator())
+        : head(nullptr), tail(nullptr), length(0), alloc(allocator) {}
+
+    ~UnrolledList() {
+        clear_chunks();
+    }
+
+    UnrolledList(const UnrolledList& other)
+        : head(nullptr), tail(nullptr), length(0),
+          alloc(ChunkTraits::select_on_container_copy_construction(other.alloc)) {
+        try {
+            copy_from(other);
+        } catch (...) {
+            clear_chunks();
+            throw;
+        }
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept
+        : head(other.head), tail(other.tail), length(other.length), alloc(std::move(other.alloc)) {
+        other.head = other.tail = nullptr; // Обнуляем перемещаемый объект
+        other.length = 0;
+    }
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        if (this == &other) return *this; // Проверка на самоприсваивание
+        clear_chunks();
+        if constexpr (ChunkTraits::propagate_on_container_copy_assignment::value) {
+            alloc = other.alloc;
+        }
+        copy_from(other);
+        return *this;
+    }
+
+    UnrolledList& operator=(UnrolledList&& other)
+        noexcept(ChunkTraits::propagate_on_container_move_assignment::value || ChunkTraits::is_always_equal::value) {
+        if (this == &other) return *this; // Проверка на самоприсваивание
+        clear_chunks();
+        if constexpr (ChunkTraits::propagate_on_container_move_assignment::value) {
+            alloc = std::move(other.alloc);
+        } else if (alloc != other.alloc) { // узлы чужого аллокатора забрать нельзя — переносим значения
+            for (T& value : other) append(std::move(value));
+            return *this;
+        }
+        head = other.head;
+        tail = other.tail;
+        length = other.length;
+        other.head = other.tail = nullptr;
+        other.length = 0;
+        return *this;
+    }
+
+    void push_back(const T& value) {
+        push_back(T(value));
+    }
+
+    void push_back(T&& value) {
+        typename Instrumentation::Scope scope(Operation::Append);
+        append(std::move(value));
+    }
+
+    void push_front(const T& value) {
+        insert(0, value);
+    }
+
+    void insert(size_t index, const T& value) {
+        if (index > length) throw std::out_of_range("Index out of range");
+        if (index == length) {
+            push_back(value);
+            return;
+        }
+
+        typename Instrumentation::Scope scope(Operation::Insert);
+        T tmp(value); // value может ссылаться на элемент, который сдвинется при вставке
+        size_t offset;
+        Chunk* chunk = locate(index, offset);
+        if (chunk->count == ChunkSize) { // узел полон — делим его и выбираем нужную половину
+            split(chunk);
+            if (offset > chunk->count) {
+                offset -= chunk->count;
+                chunk = chunk->next;
+            }
+        }
+        insert_into(chunk, offset, std::move(tmp));
+    }
+
+    void insert_middle(const T& value) {
+        size_t middle_index = length / 2; // Вычисляем индекс середины списка
+        insert(middle_index, value); // Вставляем значение в середину
+    }
+
+    void erase(size_t index) {
+        if (index >= length) throw std::out_of_range("Index out of range");
+
+        typename Instrumentation::Scope scope(Operation::Erase);
+        size_t offset;
+        Chunk* chunk = locate(index, offset);
+        T* items = chunk->items();
+        Instrumentation::on_move(chunk->count - offset - 1);
+        std::move(items + offset + 1, items + chunk->count, items + offset); // сдвиг только внутри узла
+        items[chunk->count - 1].~T();
+        --chunk->count;
+        --length;
+
+        if (chunk->count == 0) {
+            unlink_chunk(chunk);
+        } else {
+            rebalance(chunk);
+        }
+    }
+
+    const T& get(size_t index) const {
+        if (index >= length) throw std::out_of_range("Index out of range");
+        size_t offset;
+        const Chunk* chunk = locate(index, offset);
+        return chunk->items()[offset];
+    }
+
+    size_t size() const {
+        return length;
+    }
+
+    void clear() {
+        clear_chunks();
+    }
+
+    Allocator get_allocator() const {
+        return Allocator(alloc);
+    }
+
+    iterator begin() { return iterator(head, 0); }
+    iterator end() { return tail ? iterator(tail, tail->count) : iterator(); }
+    const_iterator begin() const { return const_iterator(head, 0); }
+    const_iterator end() const { return tail ? const_iterator(tail, tail->count) : const_iterator(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    void print() const {
+        for (const Chunk* chunk = head; chunk != nullptr; chunk = chunk->next) {
+            for (size_t i = 0; i < chunk->count; ++i) {
+                std::cout << chunk->items()[i] << (chunk->next || i + 1 < chunk->count ? ", " : "");
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // Буферизованный вывод элементов всех чанков подряд (см. OutputFormat.h)
+    template <typename Sink>
+    void write_to(Sink&& sink, const OutputFormat& format = OutputFormat::plain()) const {
+        write_range(begin(), end(), sink, format);
+    }
+};